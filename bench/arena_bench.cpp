@@ -0,0 +1,141 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file arena_bench.cpp
+ * @brief Compares global-heap allocation against the per-query Arena on query-shaped workloads.
+ *
+ * Each workload is run as a sequence of "queries" so that chunk reuse across queries shows up.
+ */
+
+#include "bench_utils.h"
+#include "common/arena.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace minidb;
+
+namespace {
+
+    constexpr int QUERIES = 20;
+    constexpr int ROWS = 200000;
+    constexpr int DISTINCT_KEYS = 20000;
+
+    std::vector<std::string> make_input() {
+        std::vector<std::string> keys;
+        keys.reserve(ROWS);
+        for (int i = 0; i < ROWS; ++i) {
+            keys.push_back("customer_name_" + std::to_string((i * 7919) % DISTINCT_KEYS));
+        }
+        return keys;
+    }
+
+    // SELECT name, COUNT(*) FROM t GROUP BY name
+    void group_by_heap(const std::vector<std::string> &keys) {
+        std::unordered_map<std::string, int64_t> groups;
+        for (const auto &key : keys) {
+            groups[key]++;
+        }
+        bench::do_not_optimize(groups.size());
+    }
+
+    void group_by_arena(const std::vector<std::string> &keys) {
+        Arena arena;
+        using Entry = std::pair<const std::string_view, int64_t>;
+        std::unordered_map<std::string_view, int64_t, std::hash<std::string_view>, std::equal_to<>,
+                ArenaAllocator<Entry>> groups{16, std::hash<std::string_view>(), std::equal_to<>(),
+                                              ArenaAllocator<Entry>(&arena)};
+        for (const auto &key : keys) {
+            auto it = groups.find(key);
+            if (it == groups.end()) {
+                it = groups.emplace(arena.copy_string(key), 0).first;
+            }
+            it->second++;
+        }
+        bench::do_not_optimize(groups.size());
+    }
+
+    // SELECT first || ' ' || last FROM t: one intermediate string per row.
+    void concat_heap(const std::vector<std::string> &keys) {
+        std::vector<std::string> out;
+        out.reserve(keys.size());
+        for (const auto &key : keys) {
+            out.push_back(key + " " + key);
+        }
+        bench::do_not_optimize(out.size());
+    }
+
+    void concat_arena(const std::vector<std::string> &keys) {
+        Arena arena;
+        std::vector<std::string_view, ArenaAllocator<std::string_view>> out{ArenaAllocator<std::string_view>(&arena)};
+        out.reserve(keys.size());
+        for (const auto &key : keys) {
+            size_t length = key.size() * 2 + 1;
+            auto *buffer = static_cast<char *>(arena.allocate(length, 1));
+            key.copy(buffer, key.size());
+            buffer[key.size()] = ' ';
+            key.copy(buffer + key.size() + 1, key.size());
+            out.emplace_back(buffer, length);
+        }
+        bench::do_not_optimize(out.size());
+    }
+
+    // Operator state: one small node per row, e.g. hash join chain entries.
+    struct ChainEntry {
+        int64_t key;
+        int64_t payload;
+        ChainEntry *next;
+    };
+
+    void chain_heap(const std::vector<std::string> &keys) {
+        std::vector<std::unique_ptr<ChainEntry>> entries;
+        entries.reserve(keys.size());
+        ChainEntry *head = nullptr;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            entries.push_back(std::make_unique<ChainEntry>(ChainEntry{static_cast<int64_t>(i), 1, head}));
+            head = entries.back().get();
+        }
+        bench::do_not_optimize(head);
+    }
+
+    void chain_arena(const std::vector<std::string> &keys) {
+        Arena arena;
+        ChainEntry *head = nullptr;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            head = arena.make<ChainEntry>(ChainEntry{static_cast<int64_t>(i), 1, head});
+        }
+        bench::do_not_optimize(head);
+    }
+
+    void run(const char *name, const std::vector<std::string> &keys,
+             void (*heap)(const std::vector<std::string> &), void (*arena)(const std::vector<std::string> &)) {
+        bench::Measurement heap_run;
+        for (int q = 0; q < QUERIES; ++q) heap(keys);
+        heap_run.stop();
+
+        bench::Measurement arena_run;
+        for (int q = 0; q < QUERIES; ++q) arena(keys);
+        arena_run.stop();
+
+        std::printf("%-10s heap : %9.2f ms %10zu allocations\n", name, heap_run.elapsed_ms, heap_run.allocations);
+        std::printf("%-10s arena: %9.2f ms %10zu allocations\n", name, arena_run.elapsed_ms, arena_run.allocations);
+    }
+
+} // namespace
+
+int main() {
+    auto keys = make_input();
+    std::printf("%d queries x %d rows\n", QUERIES, ROWS);
+    run("group_by", keys, group_by_heap, group_by_arena);
+    run("concat", keys, concat_heap, concat_arena);
+    run("hash_chain", keys, chain_heap, chain_arena);
+    std::printf("pool chunks allocated: %zu, reused: %zu\n",
+                ChunkPool::global().chunks_allocated(), ChunkPool::global().chunks_reused());
+    return 0;
+}
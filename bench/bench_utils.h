@@ -0,0 +1,72 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+/**
+ * @file bench_utils.h
+ * @brief Timing and heap allocation counting shared by the micro benchmarks.
+ *
+ * Include this header from exactly one translation unit per benchmark executable:
+ * it replaces the global operator new/delete to count heap allocations.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace bench {
+
+    inline std::atomic<size_t> allocation_count{0};
+
+    /**
+     * @brief Measures wall time and heap allocations between construction and stop().
+     */
+    class Measurement {
+    public:
+        Measurement() : start_allocations(allocation_count.load()), start(std::chrono::steady_clock::now()) {}
+
+        void stop() {
+            auto end = std::chrono::steady_clock::now();
+            elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+            allocations = allocation_count.load() - start_allocations;
+        }
+
+        double elapsed_ms = 0;
+        size_t allocations = 0;
+
+    private:
+        size_t start_allocations;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /**
+     * @brief Prevents the optimizer from discarding a computed value.
+     */
+    template<typename T>
+    inline void do_not_optimize(const T &value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+} // namespace bench
+
+void *operator new(size_t size) {
+    bench::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete[](void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
@@ -0,0 +1,97 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file explain_analyze_bench.cpp
+ * @brief Runs a scan -> filter -> project -> SUM pipeline with and without the EXPLAIN ANALYZE
+ * instrumentation (per-batch wall/CPU timing, per-operator row counts) to measure its overhead.
+ */
+
+#include "bench_utils.h"
+#include "execution/operator_stats.h"
+#include "execution/pipeline.h"
+#include "storage/config.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace minidb;
+
+namespace {
+
+    // Every value is a decoded LiteralValue, so the table is kept to what fits in memory.
+    constexpr size_t ROWS = 2'000'000;
+    constexpr size_t COLUMNS = 3;
+    constexpr int RUNS = 5;
+
+    int64_t run_plain(const std::vector<RowBatch> &batches, int64_t threshold) {
+        auto pipeline = make_scan(
+                make_filter([threshold](const RowRef &r) { return r.column(0) > threshold; },
+                            make_project([](const RowRef &r) { return r.column(1) * r.column(2); },
+                                         SumAggregate<int64_t>())));
+        for (const auto &batch : batches) pipeline.produce(batch);
+        pipeline.finish();
+        return pipeline.sink().sum;
+    }
+
+    int64_t run_instrumented(const std::vector<RowBatch> &batches, int64_t threshold,
+                             OperatorStats &scan, OperatorStats &filter) {
+        auto pipeline = make_timed(&scan, make_scan(
+                make_filter([threshold](const RowRef &r) { return r.column(0) > threshold; },
+                            make_counting(&filter,
+                            make_project([](const RowRef &r) { return r.column(1) * r.column(2); },
+                                         SumAggregate<int64_t>())))));
+        for (const auto &batch : batches) pipeline.produce(batch);
+        pipeline.finish();
+        return pipeline.sink().sum;
+    }
+
+} // namespace
+
+int main() {
+    std::vector<std::vector<int64_t>> columns(COLUMNS, std::vector<int64_t>(ROWS));
+    std::mt19937_64 rng(42);
+    for (auto &column : columns) {
+        for (auto &value : column) value = static_cast<int64_t>(rng() % 1000);
+    }
+    auto fetch = [&](const RecordId &rid, column_id_t column) -> Value { return columns[column][rid.page_id + rid.slot]; };
+    std::vector<RowBatch> batches;
+    for (size_t start = 0; start < ROWS; start += BATCH_SIZE) {
+        std::vector<RecordId> rids;
+        for (size_t row = start; row < std::min<size_t>(start + BATCH_SIZE, ROWS); ++row) {
+            rids.push_back({static_cast<page_id_t>(start), static_cast<uint16_t>(row - start)});
+        }
+        RowBatch batch(std::move(rids), COLUMNS);
+        for (column_id_t column = 0; column < COLUMNS; ++column) batch.materialize(column, fetch);
+        batches.push_back(std::move(batch));
+    }
+
+    std::printf("%zu rows, batches of %zu, best of %d runs\n", ROWS, static_cast<size_t>(BATCH_SIZE), RUNS);
+    for (int64_t threshold : {0, 500, 990}) {
+        double plain_best = 1e18, instrumented_best = 1e18;
+        int64_t plain_sum = 0, instrumented_sum = 0;
+        OperatorStats scan, filter;
+        for (int r = 0; r < RUNS; ++r) {
+            bench::Measurement plain;
+            plain_sum = run_plain(batches, threshold);
+            plain.stop();
+            plain_best = std::min(plain_best, plain.elapsed_ms);
+
+            scan = filter = OperatorStats{};
+            bench::Measurement instrumented;
+            instrumented_sum = run_instrumented(batches, threshold, scan, filter);
+            instrumented.stop();
+            instrumented_best = std::min(instrumented_best, instrumented.elapsed_ms);
+        }
+        std::printf("selectivity %5.1f%%  plain: %8.2f ms  instrumented: %8.2f ms  overhead %+.1f%%  "
+                    "(reported wall %.2f ms, cpu %.2f ms)  %s\n",
+                    (999 - threshold) / 10.0, plain_best, instrumented_best,
+                    (instrumented_best / plain_best - 1) * 100,
+                    std::chrono::duration<double, std::milli>(scan.wall_time).count(),
+                    std::chrono::duration<double, std::milli>(scan.cpu_time).count(),
+                    plain_sum == instrumented_sum ? "" : "RESULT MISMATCH");
+    }
+    return 0;
+}
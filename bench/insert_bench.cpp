@@ -0,0 +1,125 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file insert_bench.cpp
+ * @brief Loads the same rows through multi-row INSERT statements of 1, 100 and 10,000 rows,
+ * once row at a time (write the target page after every row) and once batched (fill each
+ * page in one pass, then write the statement's pages with one write_pages() call).
+ */
+
+#include "bench_utils.h"
+#include "storage/disk_manager.h"
+#include "storage/table_page.h"
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    constexpr size_t ROWS = 200'000;
+    constexpr size_t ROW_WIDTH = 48;
+    constexpr int RUNS = 3;
+    const char *DB_FILE = "insert_bench.db";
+
+    struct Result {
+        double elapsed_ms;
+        page_id_t pages;
+    };
+
+    Result insert_row_at_a_time(const std::vector<std::string_view> &rows) {
+        std::filesystem::remove(DB_FILE);
+        DiskManager disk(DB_FILE);
+        char page_data[PAGE_SIZE];
+        TablePage page(page_data);
+        page.init();
+        page_id_t page_id = 0;
+
+        bench::Measurement m;
+        for (const auto &row : rows) {
+            if (!page.insert_record(row)) {
+                page.init();
+                page_id++;
+                page.insert_record(row);
+            }
+            disk.write_page(page_id, page_data);
+        }
+        m.stop();
+        return {m.elapsed_ms, page_id + 1};
+    }
+
+    Result insert_batched(const std::vector<std::string_view> &rows, size_t batch_size) {
+        std::filesystem::remove(DB_FILE);
+        DiskManager disk(DB_FILE);
+        // The statement's dirty pages, back to back. Page 0 is the current tail page.
+        std::vector<char> pages(PAGE_SIZE);
+        TablePage(pages.data()).init();
+        page_id_t tail_page_id = 0;
+
+        // One row buffer reused by every statement.
+        std::vector<std::string_view> statement;
+        statement.reserve(batch_size);
+
+        bench::Measurement m;
+        for (size_t start = 0; start < rows.size(); start += batch_size) {
+            statement.assign(rows.begin() + start, rows.begin() + std::min(rows.size(), start + batch_size));
+            size_t next = 0;
+            size_t page_count = 1;
+            while (true) {
+                next += TablePage(pages.data() + (page_count - 1) * PAGE_SIZE).insert_records(statement, next);
+                if (next == statement.size()) {
+                    break;
+                }
+                page_count++;
+                pages.resize(page_count * PAGE_SIZE);
+                TablePage(pages.data() + (page_count - 1) * PAGE_SIZE).init();
+            }
+            disk.write_pages(tail_page_id, pages.data(), page_count);
+
+            // Keep only the last, partially filled page for the next statement.
+            if (page_count > 1) {
+                std::memcpy(pages.data(), pages.data() + (page_count - 1) * PAGE_SIZE, PAGE_SIZE);
+                pages.resize(PAGE_SIZE);
+                tail_page_id += static_cast<page_id_t>(page_count - 1);
+            }
+        }
+        m.stop();
+        return {m.elapsed_ms, tail_page_id + 1};
+    }
+
+} // namespace
+
+int main() {
+    std::vector<std::string> values;
+    values.reserve(ROWS);
+    for (size_t i = 0; i < ROWS; i++) {
+        std::string row = std::to_string(i);
+        row.resize(ROW_WIDTH, '.');
+        values.push_back(std::move(row));
+    }
+    std::vector<std::string_view> rows(values.begin(), values.end());
+
+    std::printf("%zu rows of %zu bytes, best of %d runs\n", ROWS, ROW_WIDTH, RUNS);
+    for (size_t batch_size : {size_t{1}, size_t{100}, size_t{10'000}}) {
+        Result row_at_a_time{1e300, 0};
+        Result batched{1e300, 0};
+        for (int run = 0; run < RUNS; run++) {
+            Result r = insert_row_at_a_time(rows);
+            if (r.elapsed_ms < row_at_a_time.elapsed_ms) row_at_a_time = r;
+            Result b = insert_batched(rows, batch_size);
+            if (b.elapsed_ms < batched.elapsed_ms) batched = b;
+        }
+        std::printf("batch %6zu  row-at-a-time: %10.0f rows/s  batched: %10.0f rows/s  speedup %.1fx  (%d pages)\n",
+                    batch_size,
+                    ROWS / (row_at_a_time.elapsed_ms / 1000.0),
+                    ROWS / (batched.elapsed_ms / 1000.0),
+                    row_at_a_time.elapsed_ms / batched.elapsed_ms,
+                    batched.pages);
+    }
+    std::filesystem::remove(DB_FILE);
+    return 0;
+}
@@ -0,0 +1,129 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file lexer_bench.cpp
+ * @brief Tokenizes multi-megabyte SQL scripts and reports throughput (MB/s, tokens/s) and
+ * heap allocations per token. One script is multi-row INSERT statements, the other is
+ * identifier-heavy SELECT statements. The INSERT script is also parsed, once from a fully
+ * tokenized vector and once streaming tokens from the lexer.
+ */
+
+#include "bench_utils.h"
+#include "sql/lexer.h"
+#include "sql/parser.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace minidb;
+
+namespace {
+
+    constexpr size_t STATEMENTS = 2'000;
+    constexpr size_t ROWS_PER_STATEMENT = 50;
+    constexpr int RUNS = 10;
+
+    // INSERT INTO customer_orders (order_id, customer_name, ...) VALUES (...), (...);
+    std::string insert_script() {
+        std::mt19937_64 rng(42);
+        std::string script;
+        for (size_t s = 0; s < STATEMENTS; s++) {
+            script += "INSERT INTO customer_orders (order_id, customer_name, shipping_address, "
+                      "order_total, is_priority, ordered_on, shipped_at) VALUES\n";
+            for (size_t r = 0; r < ROWS_PER_STATEMENT; r++) {
+                uint64_t id = s * ROWS_PER_STATEMENT + r;
+                script += r == 0 ? "  (" : ",\n  (";
+                script += std::to_string(id) + ", 'customer number " + std::to_string(rng() % 100'000)
+                          + "', '" + std::to_string(rng() % 10'000) + " Long Street Name Apartment "
+                          + std::to_string(rng() % 500) + "', " + std::to_string(rng() % 100'000) + "."
+                          + std::to_string(rng() % 100) + ", " + (rng() % 2 ? "TRUE" : "FALSE") + ", '2026-0"
+                          + std::to_string(1 + rng() % 9) + "-1" + std::to_string(rng() % 9) + "', '2026-0"
+                          + std::to_string(1 + rng() % 9) + "-1" + std::to_string(rng() % 9) + " 1"
+                          + std::to_string(rng() % 9) + ":3" + std::to_string(rng() % 9) + ":0"
+                          + std::to_string(rng() % 9) + "')";
+            }
+            script += ";\n";
+        }
+        return script;
+    }
+
+    // SELECT customer_orders.order_total, ... FROM customer_orders JOIN ... WHERE ... GROUP BY ...;
+    std::string select_script() {
+        const char *columns[] = {"order_total", "customer_name", "shipping_address", "ordered_on",
+                                 "warehouse_region", "is_priority", "discount_code", "sales_channel"};
+        std::mt19937_64 rng(7);
+        std::string script;
+        while (script.size() < 12 * 1024 * 1024) {
+            script += "SELECT customer_orders.order_id, ";
+            for (int c = 0; c < 4; c++) {
+                script += std::string("customer_orders.") + columns[rng() % 8] + ", ";
+            }
+            script += "customer_accounts.account_manager FROM customer_orders JOIN customer_accounts "
+                      "ON customer_orders.customer_id = customer_accounts.customer_id WHERE ";
+            script += std::string("customer_orders.") + columns[rng() % 8] + " > customer_accounts.credit_limit AND "
+                      + columns[rng() % 8] + " IS NOT NULL GROUP BY customer_accounts.account_manager, "
+                      + columns[rng() % 8] + " ORDER BY customer_orders.order_id DESC LIMIT 100;\n";
+        }
+        return script;
+    }
+
+    void run(const char *name, const std::string &script) {
+        double best_ms = 1e18;
+        size_t tokens = 0, allocations = 0;
+        for (int run = 0; run < RUNS; run++) {
+            bench::Measurement m;
+            Lexer lexer(script);
+            std::vector<Token> result = lexer.tokenize();
+            m.stop();
+            bench::do_not_optimize(result);
+            if (m.elapsed_ms < best_ms) {
+                best_ms = m.elapsed_ms;
+                tokens = result.size();
+                allocations = m.allocations;
+            }
+        }
+
+        double mb = script.size() / (1024.0 * 1024.0);
+        std::printf("%-14s %5.1f MB  %8zu tokens  %8.2f ms  %7.1f MB/s  %6.2f M tokens/s  %.3f allocations/token\n",
+                    name, mb, tokens, best_ms, mb / (best_ms / 1000), tokens / (best_ms / 1000) / 1e6,
+                    static_cast<double>(allocations) / tokens);
+    }
+
+    void run_parse(const char *name, const std::string &script, bool streaming) {
+        double best_ms = 1e18;
+        size_t statements = 0;
+        for (int run = 0; run < RUNS; run++) {
+            bench::Measurement m;
+            Lexer lexer(script);
+            std::vector<Token> tokens;
+            if (!streaming) {
+                tokens = lexer.tokenize();
+            }
+            Parser parser = streaming ? Parser(lexer) : Parser(std::move(tokens));
+            statements = 0;
+            while (auto statement = parser.next_statement()) {
+                bench::do_not_optimize(statement);
+                statements++;
+            }
+            m.stop();
+            best_ms = std::min(best_ms, m.elapsed_ms);
+        }
+        std::printf("%-14s %8zu statements  %8.2f ms  %7.1f MB/s\n", name, statements, best_ms,
+                    script.size() / (1024.0 * 1024.0) / (best_ms / 1000));
+    }
+
+} // namespace
+
+int main() {
+    std::printf("best of %d runs\n", RUNS);
+    std::string inserts = insert_script();
+    run("INSERT script", inserts);
+    run("SELECT script", select_script());
+    run_parse("parse vector", inserts, false);
+    run_parse("parse stream", inserts, true);
+    return 0;
+}
@@ -0,0 +1,98 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file parse_bench.cpp
+ * @brief Parses and frees OLTP-sized statements (point lookups, short joins, single-row
+ * INSERT, UPDATE and DELETE) and reports statements per second and heap allocations per
+ * statement. Lexing is included; the tokens are streamed, so the time is dominated by
+ * building and tearing down the AST. A 10,000-row INSERT is measured the same way.
+ */
+
+#include "bench_utils.h"
+#include "sql/lexer.h"
+#include "sql/parser.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace minidb;
+
+namespace {
+
+    constexpr size_t ITERATIONS = 500'000;
+    constexpr size_t BULK_ROWS = 10'000;
+    constexpr int RUNS = 5;
+
+    const std::vector<std::string> STATEMENTS = {
+            "SELECT id, name, balance FROM accounts WHERE id = 42;",
+            "SELECT o.id, o.total, c.name FROM orders o JOIN customers c ON o.customer_id = c.id "
+            "WHERE o.id = 1001 AND o.status = 'open';",
+            "SELECT COUNT(*) FROM order_lines WHERE order_id = 1001 GROUP BY order_id;",
+            "INSERT INTO orders (id, customer_id, total, status, created_on) "
+            "VALUES (1001, 42, 99.95, 'open', '2026-10-18');",
+            "UPDATE accounts SET balance = balance - 99.95, updated = TRUE WHERE id = 42;",
+            "DELETE FROM carts WHERE customer_id = 42 AND item_count = 0;",
+    };
+
+    std::string bulk_insert() {
+        std::string statement = "INSERT INTO order_lines (order_id, line, sku, quantity, price, shipped_on) VALUES ";
+        for (size_t row = 0; row < BULK_ROWS; row++) {
+            statement += (row == 0 ? "(" : ", (") + std::to_string(row / 4) + ", " + std::to_string(row % 4) + ", 'SKU-"
+                         + std::to_string(row * 7919 % 100'000) + "', " + std::to_string(1 + row % 9) + ", "
+                         + std::to_string(row % 500) + ".99, '2026-10-18')";
+        }
+        return statement + ";";
+    }
+
+    void run_bulk_insert() {
+        const std::string statement = bulk_insert();
+        double best_ms = 1e18;
+        size_t allocations = 0;
+        for (int run = 0; run < RUNS; run++) {
+            bench::Measurement m;
+            Lexer lexer(statement);
+            Parser parser(lexer);
+            std::unique_ptr<ASTNode> insert = parser.parse();
+            bench::do_not_optimize(insert);
+            insert.reset();
+            m.stop();
+            if (m.elapsed_ms < best_ms) {
+                best_ms = m.elapsed_ms;
+                allocations = m.allocations;
+            }
+        }
+        std::printf("%zu-row INSERT: %8.3f ms  %8zu allocations  %.3f allocations/value\n", BULK_ROWS, best_ms,
+                    allocations, static_cast<double>(allocations) / (BULK_ROWS * 6));
+    }
+
+} // namespace
+
+int main() {
+    double best_ms = 1e18;
+    size_t allocations = 0;
+    size_t nodes = 0;
+    for (int run = 0; run < RUNS; run++) {
+        bench::Measurement m;
+        for (size_t i = 0; i < ITERATIONS; i++) {
+            Lexer lexer(STATEMENTS[i % STATEMENTS.size()]);
+            Parser parser(lexer);
+            std::unique_ptr<ASTNode> statement = parser.parse();
+            bench::do_not_optimize(statement);
+            nodes += statement != nullptr;
+        }
+        m.stop();
+        if (m.elapsed_ms < best_ms) {
+            best_ms = m.elapsed_ms;
+            allocations = m.allocations;
+        }
+    }
+
+    std::printf("%zu statements, best of %d runs%s\n", ITERATIONS, RUNS, nodes == ITERATIONS * RUNS ? "" : " (parse failed)");
+    std::printf("parse+free: %8.3f us/statement  %7.2f K statements/s  %6.1f allocations/statement\n",
+                best_ms * 1000 / ITERATIONS, ITERATIONS / best_ms, static_cast<double>(allocations) / ITERATIONS);
+    run_bulk_insert();
+    return 0;
+}
@@ -0,0 +1,169 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file pipeline_bench.cpp
+ * @brief Runs the same scan -> filter -> project -> SUM plan on the fused push pipeline
+ * and on a classic pull-based (Volcano) iterator tree with one virtual next() per tuple.
+ */
+
+#include "bench_utils.h"
+#include "execution/pipeline.h"
+#include "storage/config.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <variant>
+#include <vector>
+
+using namespace minidb;
+
+namespace {
+
+    constexpr size_t ROWS = 20'000'000;
+    constexpr size_t COLUMNS = 3;
+    constexpr int RUNS = 5;
+    constexpr size_t BATCH_ROWS = BATCH_SIZE;
+
+    // Pull-based executor: each operator asks its child for the next tuple.
+    struct Tuple {
+        const RowBatch *batch;
+        uint32_t row;
+        int64_t value;
+    };
+
+    int64_t integer(const Tuple &tuple, column_id_t column) {
+        return std::get<int64_t>(tuple.batch->value(column, tuple.row));
+    }
+
+    class PullOperator {
+    public:
+        virtual ~PullOperator() = default;
+        virtual bool next(Tuple &out) = 0;
+    };
+
+    class PullScan : public PullOperator {
+    public:
+        explicit PullScan(const std::vector<RowBatch> &batches) : batches(batches) {}
+
+        bool next(Tuple &out) override {
+            while (batch_index < batches.size()) {
+                const RowBatch &batch = batches[batch_index];
+                if (position < batch.selected_count()) {
+                    out.batch = &batch;
+                    out.row = batch.selection()[position++];
+                    return true;
+                }
+                batch_index++;
+                position = 0;
+            }
+            return false;
+        }
+
+    private:
+        const std::vector<RowBatch> &batches;
+        size_t batch_index = 0;
+        size_t position = 0;
+    };
+
+    class PullFilter : public PullOperator {
+    public:
+        PullFilter(std::unique_ptr<PullOperator> child, column_id_t column, int64_t threshold)
+                : child(std::move(child)), column(column), threshold(threshold) {}
+
+        bool next(Tuple &out) override {
+            while (child->next(out)) {
+                if (integer(out, column) > threshold) return true;
+            }
+            return false;
+        }
+
+    private:
+        std::unique_ptr<PullOperator> child;
+        column_id_t column;
+        int64_t threshold;
+    };
+
+    class PullProject : public PullOperator {
+    public:
+        PullProject(std::unique_ptr<PullOperator> child, column_id_t a, column_id_t b) : child(std::move(child)), a(a), b(b) {}
+
+        bool next(Tuple &out) override {
+            if (!child->next(out)) return false;
+            out.value = integer(out, a) * integer(out, b);
+            return true;
+        }
+
+    private:
+        std::unique_ptr<PullOperator> child;
+        column_id_t a, b;
+    };
+
+    int64_t run_pull(const std::vector<RowBatch> &batches, int64_t threshold) {
+        auto plan = std::make_unique<PullProject>(
+                std::make_unique<PullFilter>(std::make_unique<PullScan>(batches), 0, threshold), 1, 2);
+        int64_t sum = 0;
+        Tuple tuple{};
+        while (plan->next(tuple)) {
+            sum += tuple.value;
+        }
+        return sum;
+    }
+
+    int64_t run_push(const std::vector<RowBatch> &batches, int64_t threshold) {
+        auto pipeline = make_scan(
+                make_filter([threshold](const RowRef &r) { return r.column(0) > threshold; },
+                            make_project([](const RowRef &r) { return r.column(1) * r.column(2); },
+                                         SumAggregate<int64_t>())));
+        for (const auto &batch : batches) {
+            pipeline.produce(batch);
+        }
+        pipeline.finish();
+        return pipeline.sink().sum;
+    }
+
+} // namespace
+
+int main() {
+    // The batches hold about 2.4 GB of decoded values, so the raw columns are generated one batch at a time.
+    std::mt19937_64 rng(42);
+    std::vector<std::vector<int64_t>> columns(COLUMNS, std::vector<int64_t>(BATCH_ROWS));
+    auto fetch = [&](const RecordId &rid, column_id_t column) -> Value { return columns[column][rid.slot]; };
+    std::vector<RowBatch> batches;
+    batches.reserve((ROWS + BATCH_ROWS - 1) / BATCH_ROWS);
+    for (size_t start = 0; start < ROWS; start += BATCH_ROWS) {
+        std::vector<RecordId> rids;
+        for (size_t row = start; row < std::min<size_t>(start + BATCH_ROWS, ROWS); ++row) {
+            rids.push_back({static_cast<page_id_t>(start), static_cast<uint16_t>(row - start)});
+        }
+        for (auto &column : columns) {
+            for (auto &value : column) value = static_cast<int64_t>(rng() % 1000);
+        }
+        RowBatch batch(std::move(rids), COLUMNS);
+        for (column_id_t column = 0; column < COLUMNS; ++column) batch.materialize(column, fetch);
+        batches.push_back(std::move(batch));
+    }
+
+    std::printf("%zu rows, batches of %zu, best of %d runs\n", ROWS, BATCH_ROWS, RUNS);
+    for (int64_t threshold : {0, 500, 990}) {
+        double pull_best = 1e18, push_best = 1e18;
+        int64_t pull_sum = 0, push_sum = 0;
+        for (int r = 0; r < RUNS; ++r) {
+            bench::Measurement pull;
+            pull_sum = run_pull(batches, threshold);
+            pull.stop();
+            pull_best = std::min(pull_best, pull.elapsed_ms);
+
+            bench::Measurement push;
+            push_sum = run_push(batches, threshold);
+            push.stop();
+            push_best = std::min(push_best, push.elapsed_ms);
+        }
+        std::printf("selectivity %5.1f%%  pull: %8.2f ms  push: %8.2f ms  speedup %.2fx  %s\n",
+                    (999 - threshold) / 10.0, pull_best, push_best, pull_best / push_best,
+                    pull_sum == push_sum ? "" : "RESULT MISMATCH");
+    }
+    return 0;
+}
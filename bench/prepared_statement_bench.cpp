@@ -0,0 +1,140 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file prepared_statement_bench.cpp
+ * @brief Executes 50 parameterized statement shapes over and over, once lexing, parsing and
+ * planning every execution from scratch and once through the PlanCache, and reports the
+ * per-execution overhead of each (statement preparation and parameter binding only).
+ */
+
+#include "bench_utils.h"
+#include "optimizer/plan_cache.h"
+#include "sql/lexer.h"
+#include "sql/parameters.h"
+#include "sql/parser.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace minidb;
+
+namespace {
+
+    constexpr size_t SHAPES = 50;
+    constexpr size_t TABLES = 5;
+    constexpr size_t EXECUTIONS = 200'000;
+    constexpr int RUNS = 3;
+
+    std::vector<std::string> statement_shapes() {
+        std::vector<std::string> shapes;
+        for (size_t i = 0; shapes.size() < SHAPES; i++) {
+            std::string table = "t" + std::to_string(i % TABLES);
+            std::string column = "c" + std::to_string(i);
+            switch (i % 5) {
+                case 0:
+                    shapes.push_back("SELECT id, " + column + " FROM " + table + " WHERE k = ?;");
+                    break;
+                case 1:
+                    shapes.push_back("SELECT " + column + ", name FROM " + table + " WHERE k = ? AND v > ?;");
+                    break;
+                case 2:
+                    shapes.push_back("SELECT a.id, b." + column + " FROM " + table + " a JOIN t"
+                                     + std::to_string((i + 1) % TABLES) + " b ON a.k = b.k WHERE a.v < ?;");
+                    break;
+                case 3:
+                    shapes.push_back("INSERT INTO " + table + " (id, k, " + column + ") VALUES (?, ?, 'x');");
+                    break;
+                default:
+                    shapes.push_back("UPDATE " + table + " SET " + column + " = ? WHERE k = ?;");
+                    break;
+            }
+        }
+        return shapes;
+    }
+
+    ParameterValues parameters_for(size_t execution, size_t count) {
+        ParameterValues values;
+        values.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            values.emplace_back(static_cast<int64_t>(execution + i));
+        }
+        return values;
+    }
+
+    size_t run_from_scratch(const std::vector<std::string> &shapes, const StatisticsCatalog &catalog,
+                            const IndexCatalog &indexes) {
+        size_t checksum = 0;
+        for (size_t execution = 0; execution < EXECUTIONS; execution++) {
+            const std::string &text = shapes[execution % shapes.size()];
+            Lexer lexer(text);
+            Parser parser(lexer.tokenize());
+            std::shared_ptr<const ASTNode> statement = parser.parse();
+            PreparedStatement prepared = prepare_statement(std::move(statement), parser.parameter_count(),
+                                                           catalog, indexes);
+            ParameterValues values = parameters_for(execution, prepared.parameter_count);
+            checksum += values.size() + (prepared.plan != nullptr);
+        }
+        return checksum;
+    }
+
+    size_t run_cached(const std::vector<std::string> &shapes, PlanCache &cache) {
+        size_t checksum = 0;
+        for (size_t execution = 0; execution < EXECUTIONS; execution++) {
+            std::shared_ptr<const PreparedStatement> prepared = cache.get(shapes[execution % shapes.size()]);
+            ParameterValues values = parameters_for(execution, prepared->parameter_count);
+            checksum += values.size() + (prepared->plan != nullptr);
+        }
+        return checksum;
+    }
+
+} // namespace
+
+int main() {
+    StatisticsCatalog catalog;
+    IndexCatalog indexes;
+    for (size_t t = 0; t < TABLES; t++) {
+        std::string table = "t" + std::to_string(t);
+        catalog.register_table(table, {"k"});
+        StatisticsDelta delta;
+        delta.add_rows(table, 1'000'000);
+        catalog.commit(delta);
+        indexes[table] = {{table + "_k", {"k"}}};
+    }
+    std::vector<std::string> shapes = statement_shapes();
+    PlanCache cache(catalog, indexes);
+
+    double scratch_best = 1e18, cached_best = 1e18;
+    size_t scratch_allocations = 0, cached_allocations = 0;
+    size_t scratch_sum = 0, cached_sum = 0;
+    for (int run = 0; run < RUNS; run++) {
+        bench::Measurement scratch;
+        scratch_sum = run_from_scratch(shapes, catalog, indexes);
+        scratch.stop();
+        if (scratch.elapsed_ms < scratch_best) {
+            scratch_best = scratch.elapsed_ms;
+            scratch_allocations = scratch.allocations;
+        }
+
+        bench::Measurement cached;
+        cached_sum = run_cached(shapes, cache);
+        cached.stop();
+        if (cached.elapsed_ms < cached_best) {
+            cached_best = cached.elapsed_ms;
+            cached_allocations = cached.allocations;
+        }
+    }
+
+    PlanCacheStats stats = cache.stats();
+    std::printf("%zu executions over %zu statement shapes, best of %d runs\n", EXECUTIONS, SHAPES, RUNS);
+    std::printf("lex+parse+plan:  %8.2f us/execution  %6.1f allocations/execution\n",
+                scratch_best * 1000 / EXECUTIONS, static_cast<double>(scratch_allocations) / EXECUTIONS);
+    std::printf("plan cache:      %8.2f us/execution  %6.1f allocations/execution  speedup %.1fx\n",
+                cached_best * 1000 / EXECUTIONS, static_cast<double>(cached_allocations) / EXECUTIONS,
+                scratch_best / cached_best);
+    std::printf("cache hits %llu, misses %llu  %s\n", static_cast<unsigned long long>(stats.hits),
+                static_cast<unsigned long long>(stats.misses), scratch_sum == cached_sum ? "" : "RESULT MISMATCH");
+    return 0;
+}
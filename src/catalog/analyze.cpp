@@ -0,0 +1,81 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file analyze.cpp
+ * @brief Page sampling for ANALYZE.
+ */
+
+#include "analyze.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include "storage/table_page.h"
+
+namespace minidb {
+
+    std::vector<size_t> choose_sample_pages(size_t page_count, size_t sample_size, uint64_t seed) {
+        std::vector<size_t> positions;
+        if (sample_size >= page_count) {
+            positions.resize(page_count);
+            for (size_t i = 0; i < page_count; i++) positions[i] = i;
+            return positions;
+        }
+        // Floyd's algorithm: sample_size draws, no rejection loop, no O(page_count) memory.
+        std::mt19937_64 rng(seed);
+        std::unordered_set<size_t> chosen;
+        for (size_t j = page_count - sample_size; j < page_count; j++) {
+            size_t t = std::uniform_int_distribution<size_t>(0, j)(rng);
+            chosen.insert(chosen.count(t) ? j : t);
+        }
+        positions.assign(chosen.begin(), chosen.end());
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    AnalyzeResult analyze_table(DiskManager &disk_manager, const std::vector<page_id_t> &table_pages,
+                                size_t column_count, const RowDecoder &decode, const AnalyzeOptions &options) {
+        std::vector<ColumnStatisticsBuilder> builders;
+        builders.reserve(column_count);
+        for (size_t column = 0; column < column_count; column++) {
+            builders.emplace_back(options.reservoir_size, options.seed + column);
+        }
+
+        AnalyzeResult result;
+        uint64_t rows_sampled = 0;
+        char page_data[PAGE_SIZE];
+        for (size_t position : choose_sample_pages(table_pages.size(), options.sample_pages, options.seed)) {
+            page_id_t page_id = table_pages[position];
+            if (disk_manager.read_page(page_id, page_data) != IOResult::SUCCESS) {
+                throw std::runtime_error("ANALYZE failed to read page " + std::to_string(page_id));
+            }
+            result.pages_read++;
+
+            TablePage page(page_data);
+            for (uint16_t slot = 0; slot < page.get_slot_count(); slot++) {
+                SlotState state = page.get_slot_state(slot);
+                if (state != SlotState::Normal && state != SlotState::Redirect) {
+                    continue; // Dead, or reached through its redirect.
+                }
+                std::vector<std::optional<LiteralValue>> values = decode(*page.get_record(slot));
+                for (size_t column = 0; column < column_count && column < values.size(); column++) {
+                    builders[column].add(values[column]);
+                }
+                rows_sampled++;
+            }
+        }
+
+        if (result.pages_read > 0) {
+            result.row_count = static_cast<double>(rows_sampled) / static_cast<double>(result.pages_read)
+                               * static_cast<double>(table_pages.size());
+        }
+        for (const auto &builder : builders) {
+            result.columns.push_back(builder.build(result.row_count, options.histogram_buckets, options.most_common_values));
+        }
+        return result;
+    }
+
+} // namespace minidb
@@ -0,0 +1,67 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include "column_statistics.h"
+#include "storage/disk_manager.h"
+
+namespace minidb {
+
+    /// Decodes a stored record into its column values; nullopt is SQL NULL.
+    using RowDecoder = std::function<std::vector<std::optional<LiteralValue>>(std::string_view record)>;
+
+    /**
+     * @struct AnalyzeOptions
+     * @brief Sampling budget and summary sizes for ANALYZE.
+     */
+    struct AnalyzeOptions {
+        // Pages read per table, whatever its size. Reading a fixed number of pages keeps
+        // ANALYZE time flat as tables grow.
+        size_t sample_pages = 3000;
+        // Values per column kept for the histogram and the most common values.
+        size_t reservoir_size = 30000;
+        size_t histogram_buckets = 100;
+        size_t most_common_values = 10;
+        uint64_t seed = 0;
+    };
+
+    /**
+     * @struct AnalyzeResult
+     * @brief Statistics of one table gathered by analyze_table().
+     */
+    struct AnalyzeResult {
+        double row_count = 0; // Estimated from the live rows per sampled page
+        size_t pages_read = 0;
+        std::vector<ColumnStatistics> columns;
+    };
+
+    /**
+     * @brief Chooses `sample_size` distinct page positions out of `page_count`, uniformly at random.
+     * @return Positions in ascending order, so that the sampled pages are read front to back.
+     */
+    std::vector<size_t> choose_sample_pages(size_t page_count, size_t sample_size, uint64_t seed);
+
+    /**
+     * @brief Samples a table's data pages and builds per-column statistics.
+     *
+     * Every live row of a sampled page is used, so a sample of pages gives many rows for
+     * little I/O. If the table has no more pages than the budget, every page is read.
+     *
+     * @param disk_manager Source of the pages.
+     * @param table_pages Data pages of the table.
+     * @param column_count Number of values decode returns per row.
+     * @param decode Turns a stored record into column values.
+     * @throws std::runtime_error if a sampled page cannot be read.
+     */
+    AnalyzeResult analyze_table(DiskManager &disk_manager, const std::vector<page_id_t> &table_pages,
+                                size_t column_count, const RowDecoder &decode, const AnalyzeOptions &options = {});
+
+} // namespace minidb
@@ -0,0 +1,225 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file column_statistics.cpp
+ * @brief HyperLogLog, equi-depth histograms and most-common-value lists.
+ */
+
+#include "column_statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include "common/hash.h"
+
+namespace minidb {
+
+    namespace {
+
+        uint64_t hash_value(const LiteralValue &value) {
+            int64_t bits;
+            if (auto *i = std::get_if<int64_t>(&value)) {
+                bits = *i;
+            } else if (auto *d = std::get_if<double>(&value)) {
+                std::memcpy(&bits, d, sizeof(bits));
+            } else if (auto *s = std::get_if<std::string>(&value)) {
+                bits = static_cast<int64_t>(std::hash<std::string_view>()(*s));
+            } else if (auto *b = std::get_if<bool>(&value)) {
+                bits = *b;
+            } else if (auto *date = std::get_if<SQLDate>(&value)) {
+                bits = (date->year * 100LL + date->month) * 100 + date->day;
+            } else {
+                const auto &ts = std::get<SQLTimestamp>(value);
+                bits = ((((ts.year * 100LL + ts.month) * 100 + ts.day) * 100 + ts.hour) * 100 + ts.minute) * 100 + ts.second;
+            }
+            return hash_int64(bits ^ static_cast<int64_t>(value.index() * 0x9e3779b97f4a7c15ULL));
+        }
+
+        bool value_less(const LiteralValue &a, const LiteralValue &b) {
+            auto cmp = compare_literals(a, b);
+            return cmp ? *cmp < 0 : a.index() < b.index();
+        }
+
+        bool value_equal(const LiteralValue &a, const LiteralValue &b) {
+            auto cmp = compare_literals(a, b);
+            return cmp && *cmp == 0;
+        }
+
+        std::optional<double> as_number(const LiteralValue &value) {
+            if (auto *i = std::get_if<int64_t>(&value)) return static_cast<double>(*i);
+            if (auto *d = std::get_if<double>(&value)) return *d;
+            return std::nullopt;
+        }
+
+    } // namespace
+
+    HyperLogLog::HyperLogLog(uint8_t precision) : precision(precision), registers(size_t{1} << precision, 0) {}
+
+    void HyperLogLog::add_hash(uint64_t hash) {
+        size_t index = hash >> (64 - precision);
+        uint64_t rest = hash << precision;
+        auto rank = static_cast<uint8_t>(rest == 0 ? 64 - precision + 1 : __builtin_clzll(rest) + 1);
+        registers[index] = std::max(registers[index], rank);
+    }
+
+    void HyperLogLog::add(const LiteralValue &value) {
+        add_hash(hash_value(value));
+    }
+
+    void HyperLogLog::merge(const HyperLogLog &other) {
+        for (size_t i = 0; i < registers.size() && i < other.registers.size(); i++) {
+            registers[i] = std::max(registers[i], other.registers[i]);
+        }
+    }
+
+    double HyperLogLog::estimate() const {
+        auto m = static_cast<double>(registers.size());
+        double sum = 0;
+        size_t zeros = 0;
+        for (uint8_t reg : registers) {
+            sum += std::ldexp(1.0, -reg);
+            zeros += reg == 0;
+        }
+        double alpha = 0.7213 / (1.0 + 1.079 / m);
+        double estimate = alpha * m * m / sum;
+        if (estimate <= 2.5 * m && zeros != 0) {
+            estimate = m * std::log(m / static_cast<double>(zeros)); // Linear counting for small cardinalities.
+        }
+        return estimate;
+    }
+
+    double ColumnStatistics::equal_selectivity(const LiteralValue &value) const {
+        double common_fraction = 0;
+        for (const auto &[common, fraction] : most_common_values) {
+            if (value_equal(common, value)) return fraction;
+            common_fraction += fraction;
+        }
+        double other_values = std::max(1.0, distinct_count - static_cast<double>(most_common_values.size()));
+        return std::max(0.0, 1.0 - null_fraction - common_fraction) / other_values;
+    }
+
+    double ColumnStatistics::less_than_selectivity(const LiteralValue &value) const {
+        double common_fraction = 0;
+        double common_below = 0;
+        for (const auto &[common, fraction] : most_common_values) {
+            common_fraction += fraction;
+            if (value_less(common, value)) common_below += fraction;
+        }
+
+        double histogram_position = 0;
+        if (histogram_bounds.size() == 1) {
+            histogram_position = value_less(histogram_bounds[0], value) ? 1.0 : 0.0;
+        } else if (histogram_bounds.size() > 1) {
+            auto buckets = static_cast<double>(histogram_bounds.size() - 1);
+            auto upper = std::lower_bound(histogram_bounds.begin(), histogram_bounds.end(), value, value_less);
+            if (upper == histogram_bounds.begin()) {
+                histogram_position = 0;
+            } else if (upper == histogram_bounds.end()) {
+                histogram_position = 1;
+            } else {
+                // Interpolate linearly inside the bucket when the values are numeric.
+                double within = 0.5;
+                auto low = as_number(*(upper - 1));
+                auto high = as_number(*upper);
+                auto point = as_number(value);
+                if (low && high && point && *high > *low) {
+                    within = (*point - *low) / (*high - *low);
+                }
+                histogram_position = (static_cast<double>(upper - histogram_bounds.begin() - 1) + within) / buckets;
+            }
+        }
+        double histogram_fraction = std::max(0.0, 1.0 - null_fraction - common_fraction);
+        return common_below + histogram_position * histogram_fraction;
+    }
+
+    ColumnStatisticsBuilder::ColumnStatisticsBuilder(size_t reservoir_size, uint64_t seed)
+        : reservoir_size(std::max<size_t>(reservoir_size, 1)), rng(seed) {}
+
+    void ColumnStatisticsBuilder::add(const std::optional<LiteralValue> &value) {
+        rows_seen++;
+        if (!value) {
+            nulls_seen++;
+            return;
+        }
+        sketch.add(*value);
+        uint64_t non_null_seen = rows_seen - nulls_seen;
+        if (reservoir.size() < reservoir_size) {
+            reservoir.push_back(*value);
+        } else {
+            uint64_t slot = rng() % non_null_seen;
+            if (slot < reservoir_size) reservoir[slot] = *value;
+        }
+    }
+
+    ColumnStatistics ColumnStatisticsBuilder::build(double table_rows, size_t histogram_buckets,
+                                                    size_t most_common_count) const {
+        ColumnStatistics statistics;
+        if (rows_seen == 0) {
+            return statistics;
+        }
+        statistics.null_fraction = static_cast<double>(nulls_seen) / static_cast<double>(rows_seen);
+        if (reservoir.empty()) {
+            return statistics;
+        }
+
+        std::vector<LiteralValue> sorted(reservoir);
+        std::sort(sorted.begin(), sorted.end(), value_less);
+
+        // Runs of equal values in the sorted sample: (first index, length).
+        std::vector<std::pair<size_t, size_t>> runs;
+        for (size_t i = 0; i < sorted.size();) {
+            size_t j = i + 1;
+            while (j < sorted.size() && value_equal(sorted[i], sorted[j])) j++;
+            runs.emplace_back(i, j - i);
+            i = j;
+        }
+
+        auto sample = static_cast<double>(sorted.size());
+        auto sample_distinct = static_cast<double>(runs.size());
+        double non_null_rows = std::max(table_rows, static_cast<double>(rows_seen)) * (1.0 - statistics.null_fraction);
+        if (static_cast<double>(rows_seen) >= table_rows) {
+            // The whole table was read: the sketch saw every value.
+            statistics.distinct_count = std::min(sketch.estimate(), non_null_rows);
+        } else {
+            // Guaranteed-error estimator: values seen once in the sample stand for many unseen ones.
+            double singletons = 0;
+            for (const auto &run : runs) singletons += run.second == 1;
+            double estimate = std::sqrt(non_null_rows / sample) * singletons + (sample_distinct - singletons);
+            statistics.distinct_count = std::min(std::max({estimate, sketch.estimate(), sample_distinct}), non_null_rows);
+        }
+
+        // Most common values: noticeably more frequent than the average value.
+        std::vector<std::pair<size_t, size_t>> common(runs);
+        std::sort(common.begin(), common.end(), [](const auto &a, const auto &b) { return a.second > b.second; });
+        double average = sample / sample_distinct;
+        std::vector<bool> is_common(sorted.size(), false);
+        for (const auto &[first, count] : common) {
+            if (statistics.most_common_values.size() == most_common_count || count < 2
+                || static_cast<double>(count) <= 1.25 * average) {
+                break;
+            }
+            double fraction = static_cast<double>(count) / sample * (1.0 - statistics.null_fraction);
+            statistics.most_common_values.emplace_back(sorted[first], fraction);
+            std::fill(is_common.begin() + static_cast<long>(first), is_common.begin() + static_cast<long>(first + count), true);
+        }
+
+        // Equi-depth histogram over the remaining values.
+        std::vector<LiteralValue> rest;
+        for (size_t i = 0; i < sorted.size(); i++) {
+            if (!is_common[i]) rest.push_back(sorted[i]);
+        }
+        if (rest.size() == 1 || histogram_buckets == 0) {
+            if (!rest.empty()) statistics.histogram_bounds.push_back(rest.front());
+        } else if (!rest.empty()) {
+            size_t buckets = std::min(histogram_buckets, rest.size() - 1);
+            for (size_t i = 0; i <= buckets; i++) {
+                statistics.histogram_bounds.push_back(rest[i * (rest.size() - 1) / buckets]);
+            }
+        }
+        return statistics;
+    }
+
+} // namespace minidb
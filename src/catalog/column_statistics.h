@@ -0,0 +1,98 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+#include "sql/literal_value.h"
+
+namespace minidb {
+
+    /**
+     * @class HyperLogLog
+     * @brief Fixed-memory estimate of the number of distinct values in a stream.
+     *
+     * Uses 2^precision one-byte registers (4 KB at the default precision of 12) for a
+     * standard error of about 1.04 / sqrt(2^precision), i.e. 1.6%. Sketches built over
+     * disjoint parts of a table can be merged.
+     */
+    class HyperLogLog {
+    public:
+        explicit HyperLogLog(uint8_t precision = 12);
+
+        void add_hash(uint64_t hash);
+
+        void add(const LiteralValue &value);
+
+        /// @brief Combines another sketch of the same precision into this one.
+        void merge(const HyperLogLog &other);
+
+        double estimate() const;
+
+    private:
+        uint8_t precision;
+        std::vector<uint8_t> registers;
+    };
+
+    /**
+     * @struct ColumnStatistics
+     * @brief Distribution summary of one column, as gathered by ANALYZE.
+     */
+    struct ColumnStatistics {
+        double null_fraction = 0;
+        double distinct_count = 0;
+        // Most common values and the fraction of all rows holding each, most frequent first.
+        std::vector<std::pair<LiteralValue, double>> most_common_values;
+        // Equi-depth histogram: bucket i holds the values in (bounds[i], bounds[i + 1]], each an equal share of rows.
+        std::vector<LiteralValue> histogram_bounds;
+
+        /// @brief Estimated fraction of rows where column = value.
+        double equal_selectivity(const LiteralValue &value) const;
+
+        /// @brief Estimated fraction of rows where column < value.
+        double less_than_selectivity(const LiteralValue &value) const;
+    };
+
+    /**
+     * @class ColumnStatisticsBuilder
+     * @brief Accumulates sampled values of one column and summarizes them.
+     *
+     * Keeps a bounded uniform reservoir of non-null values for the histogram and the most
+     * common values, and a HyperLogLog sketch of every value seen.
+     */
+    class ColumnStatisticsBuilder {
+    public:
+        /**
+         * @param reservoir_size Values kept for the histogram and the most common values.
+         * @param seed Seed of the reservoir's random choices, for repeatable results.
+         */
+        explicit ColumnStatisticsBuilder(size_t reservoir_size = 30000, uint64_t seed = 0);
+
+        /// @brief Adds one sampled value. nullopt is SQL NULL.
+        void add(const std::optional<LiteralValue> &value);
+
+        /**
+         * @brief Summarizes the column.
+         * @param table_rows Estimated rows in the whole table. Used to scale the distinct count
+         *                   when only part of the table was sampled.
+         * @param histogram_buckets Number of equi-depth buckets.
+         * @param most_common_count Maximum number of most common values to keep.
+         */
+        ColumnStatistics build(double table_rows, size_t histogram_buckets = 100, size_t most_common_count = 10) const;
+
+    private:
+        size_t reservoir_size;
+        std::mt19937_64 rng;
+        std::vector<LiteralValue> reservoir;
+        HyperLogLog sketch;
+        uint64_t rows_seen = 0;
+        uint64_t nulls_seen = 0;
+    };
+
+} // namespace minidb
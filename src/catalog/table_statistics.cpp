@@ -0,0 +1,175 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file table_statistics.cpp
+ * @brief Transactional maintenance of row counts and indexed column bounds, and storage of
+ * ANALYZE results.
+ */
+
+#include "table_statistics.h"
+#include <algorithm>
+#include <cctype>
+
+namespace minidb {
+
+    namespace {
+
+        std::string normalize(const std::string &name) {
+            std::string lowered(name);
+            std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lowered;
+        }
+
+        bool less(const LiteralValue &a, const LiteralValue &b) {
+            auto cmp = compare_literals(a, b);
+            return cmp && *cmp < 0;
+        }
+
+        void keep_min(std::optional<LiteralValue> &current, const LiteralValue &value) {
+            if (!current || less(value, *current)) current = value;
+        }
+
+        void keep_max(std::optional<LiteralValue> &current, const LiteralValue &value) {
+            if (!current || less(*current, value)) current = value;
+        }
+
+    } // namespace
+
+    const ColumnBounds *TableStatistics::bounds(const std::string &column) const {
+        auto it = indexed_columns.find(normalize(column));
+        return it == indexed_columns.end() ? nullptr : &it->second;
+    }
+
+    const ColumnStatistics *TableStatistics::column_statistics(const std::string &column) const {
+        auto it = columns.find(normalize(column));
+        return it == columns.end() ? nullptr : &it->second;
+    }
+
+    void StatisticsDelta::add_rows(const std::string &table, int64_t count) {
+        tables[normalize(table)].row_delta += count;
+    }
+
+    void StatisticsDelta::insert_value(const std::string &table, const std::string &column, const LiteralValue &value) {
+        ColumnDelta &delta = tables[normalize(table)].columns[normalize(column)];
+        keep_min(delta.min_inserted, value);
+        keep_max(delta.max_inserted, value);
+    }
+
+    void StatisticsDelta::delete_value(const std::string &table, const std::string &column, const LiteralValue &value) {
+        ColumnDelta &delta = tables[normalize(table)].columns[normalize(column)];
+        keep_min(delta.min_deleted, value);
+        keep_max(delta.max_deleted, value);
+    }
+
+    void StatisticsCatalog::register_table(const std::string &table, const std::vector<std::string> &indexed_columns) {
+        TableStatistics statistics;
+        for (const auto &column : indexed_columns) {
+            statistics.indexed_columns[normalize(column)] = ColumnBounds{};
+        }
+        std::string name = normalize(table);
+        std::lock_guard<std::mutex> guard(lock);
+        tables[name] = std::move(statistics);
+        plan_versions[name]++;
+    }
+
+    void StatisticsCatalog::drop_table(const std::string &table) {
+        std::string name = normalize(table);
+        std::lock_guard<std::mutex> guard(lock);
+        tables.erase(name);
+        plan_versions[name]++;
+    }
+
+    std::optional<TableStatistics> StatisticsCatalog::get(const std::string &table) const {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = tables.find(normalize(table));
+        if (it == tables.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void StatisticsCatalog::commit(const StatisticsDelta &delta) {
+        std::lock_guard<std::mutex> guard(lock);
+        for (const auto &[table, table_delta] : delta.tables) {
+            auto it = tables.find(table);
+            if (it == tables.end()) {
+                continue;
+            }
+            TableStatistics &statistics = it->second;
+            int64_t row_count = static_cast<int64_t>(statistics.row_count) + table_delta.row_delta;
+            statistics.row_count = static_cast<uint64_t>(std::max<int64_t>(row_count, 0));
+
+            for (auto &[column, bounds] : statistics.indexed_columns) {
+                if (statistics.row_count == 0) {
+                    bounds = ColumnBounds{};
+                    continue;
+                }
+                auto column_delta = table_delta.columns.find(column);
+                if (column_delta == table_delta.columns.end()) {
+                    continue;
+                }
+                const StatisticsDelta::ColumnDelta &change = column_delta->second;
+
+                // A new value at or beyond a bound is the bound, whether or not the old one was exact.
+                if (change.min_inserted && (!bounds.min || !less(*bounds.min, *change.min_inserted))) {
+                    bounds.min = change.min_inserted;
+                    bounds.min_exact = true;
+                }
+                if (change.max_inserted && (!bounds.max || !less(*change.max_inserted, *bounds.max))) {
+                    bounds.max = change.max_inserted;
+                    bounds.max_exact = true;
+                }
+                // Deleting the bound value leaves the next one unknown.
+                if (change.min_deleted && bounds.min && !less(*bounds.min, *change.min_deleted)) {
+                    bounds.min_exact = false;
+                }
+                if (change.max_deleted && bounds.max && !less(*change.max_deleted, *bounds.max)) {
+                    bounds.max_exact = false;
+                }
+            }
+        }
+    }
+
+    void StatisticsCatalog::refresh_bounds(const std::string &table, const std::string &column,
+                                           std::optional<LiteralValue> min, std::optional<LiteralValue> max) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = tables.find(normalize(table));
+        if (it == tables.end()) {
+            return;
+        }
+        auto bounds = it->second.indexed_columns.find(normalize(column));
+        if (bounds == it->second.indexed_columns.end()) {
+            return;
+        }
+        bounds->second = ColumnBounds{std::move(min), std::move(max), true, true};
+    }
+
+    void StatisticsCatalog::store_analysis(const std::string &table, double row_count,
+                                           const std::vector<std::pair<std::string, ColumnStatistics>> &columns) {
+        std::string name = normalize(table);
+        std::lock_guard<std::mutex> guard(lock);
+        TableStatistics &statistics = tables[name];
+        statistics.analyzed_row_count = row_count;
+        for (const auto &[column, column_statistics] : columns) {
+            statistics.columns[normalize(column)] = column_statistics;
+        }
+        plan_versions[name]++;
+    }
+
+    uint64_t StatisticsCatalog::plan_version(const std::string &table) const {
+        std::string name = normalize(table);
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = plan_versions.find(name);
+        return it == plan_versions.end() ? 0 : it->second;
+    }
+
+    void StatisticsCatalog::invalidate_plans(const std::string &table) {
+        std::string name = normalize(table);
+        std::lock_guard<std::mutex> guard(lock);
+        plan_versions[name]++;
+    }
+
+} // namespace minidb
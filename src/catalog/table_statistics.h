@@ -0,0 +1,153 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "column_statistics.h"
+#include "sql/literal_value.h"
+
+namespace minidb {
+
+    /**
+     * @struct ColumnBounds
+     * @brief Smallest and largest value of an indexed column.
+     *
+     * A delete can remove the current minimum or maximum, and the next one is not known
+     * without reading the index. The bound is then kept but flagged as inexact, and the
+     * planner reads the index endpoint instead.
+     */
+    struct ColumnBounds {
+        std::optional<LiteralValue> min; // nullopt while the table is empty
+        std::optional<LiteralValue> max;
+        bool min_exact = true;
+        bool max_exact = true;
+    };
+
+    /**
+     * @struct TableStatistics
+     * @brief Committed row count and indexed column bounds of one table, plus the column
+     * distributions gathered by the last ANALYZE.
+     */
+    struct TableStatistics {
+        uint64_t row_count = 0;
+        // Keyed by lower-cased column name.
+        std::unordered_map<std::string, ColumnBounds> indexed_columns;
+        // Row count estimated by the last ANALYZE; 0 if the table was never analyzed.
+        double analyzed_row_count = 0;
+        // Keyed by lower-cased column name.
+        std::unordered_map<std::string, ColumnStatistics> columns;
+
+        const ColumnBounds *bounds(const std::string &column) const;
+
+        /// @brief Distribution of a column, or nullptr if ANALYZE has not covered it.
+        const ColumnStatistics *column_statistics(const std::string &column) const;
+    };
+
+    /**
+     * @class StatisticsDelta
+     * @brief Statistics changes made by one transaction, applied atomically when it commits.
+     *
+     * A transaction records every row it inserts or deletes here. Nothing is visible to
+     * other sessions until StatisticsCatalog::commit(); an aborted transaction simply
+     * discards its delta.
+     */
+    class StatisticsDelta {
+    public:
+        void add_rows(const std::string &table, int64_t count);
+
+        void remove_rows(const std::string &table, int64_t count) { add_rows(table, -count); }
+
+        /// @brief Records the value of an indexed column in an inserted row.
+        void insert_value(const std::string &table, const std::string &column, const LiteralValue &value);
+
+        /// @brief Records the value of an indexed column in a deleted row.
+        void delete_value(const std::string &table, const std::string &column, const LiteralValue &value);
+
+        bool empty() const { return tables.empty(); }
+
+    private:
+        friend class StatisticsCatalog;
+
+        struct ColumnDelta {
+            std::optional<LiteralValue> min_inserted, max_inserted;
+            std::optional<LiteralValue> min_deleted, max_deleted;
+        };
+
+        struct TableDelta {
+            int64_t row_delta = 0;
+            std::unordered_map<std::string, ColumnDelta> columns;
+        };
+
+        std::unordered_map<std::string, TableDelta> tables;
+    };
+
+    /**
+     * @class StatisticsCatalog
+     * @brief Catalog of per-table row counts and indexed column bounds.
+     *
+     * Lets the planner answer COUNT(*), MIN and MAX without scanning the table.
+     * All methods are thread-safe.
+     *
+     * @par Usage Example:
+     * @code
+     * catalog.register_table("orders", {"id", "created_at"});
+     * StatisticsDelta delta;
+     * delta.add_rows("orders", 1);
+     * delta.insert_value("orders", "id", int64_t{42});
+     * catalog.commit(delta);   // on transaction commit
+     * @endcode
+     */
+    class StatisticsCatalog {
+    public:
+        /// @brief Starts tracking an empty table. Replaces any statistics it had.
+        void register_table(const std::string &table, const std::vector<std::string> &indexed_columns);
+
+        void drop_table(const std::string &table);
+
+        /// @brief Snapshot of the committed statistics of a table, or nullopt if it is not tracked.
+        std::optional<TableStatistics> get(const std::string &table) const;
+
+        /// @brief Applies the changes of a committed transaction, all tables at once.
+        void commit(const StatisticsDelta &delta);
+
+        /**
+         * @brief Stores bounds read from an index endpoint, making them exact again.
+         */
+        void refresh_bounds(const std::string &table, const std::string &column,
+                            std::optional<LiteralValue> min, std::optional<LiteralValue> max);
+
+        /**
+         * @brief Stores the results of ANALYZE. Columns not listed keep their previous statistics.
+         *
+         * A table that is not tracked yet is registered, without indexed columns.
+         */
+        void store_analysis(const std::string &table, double row_count,
+                            const std::vector<std::pair<std::string, ColumnStatistics>> &columns);
+
+        /**
+         * @brief Counter that changes whenever a plan for the table may have become stale.
+         *
+         * register_table(), drop_table() and store_analysis() bump it. Row count and bound
+         * changes from commit() do not: plans are not rebuilt for every write.
+         */
+        uint64_t plan_version(const std::string &table) const;
+
+        /// @brief Bumps the plan version after schema changes the catalog does not see, such as CREATE INDEX.
+        void invalidate_plans(const std::string &table);
+
+    private:
+        mutable std::mutex lock;
+        std::unordered_map<std::string, TableStatistics> tables;
+        // Kept across drop_table() so a re-created table never reuses an old version.
+        std::unordered_map<std::string, uint64_t> plan_versions;
+    };
+
+} // namespace minidb
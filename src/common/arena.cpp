@@ -0,0 +1,119 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file arena.cpp
+ * @brief Implementation of the chunk pool and the slow paths of the arena allocator.
+ */
+
+#include "arena.h"
+#include <algorithm>
+#include <cstring>
+
+namespace minidb {
+
+    ChunkPool::~ChunkPool() {
+        for (char *chunk : free_chunks) {
+            ::operator delete(chunk);
+        }
+    }
+
+    ChunkPool &ChunkPool::global() {
+        static ChunkPool pool;
+        return pool;
+    }
+
+    char *ChunkPool::acquire() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (!free_chunks.empty()) {
+                char *chunk = free_chunks.back();
+                free_chunks.pop_back();
+                reused++;
+                return chunk;
+            }
+            allocated++;
+        }
+        return static_cast<char *>(::operator new(chunk_size_));
+    }
+
+    void ChunkPool::release(char *chunk) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (free_chunks.size() < max_cached_chunks) {
+                free_chunks.push_back(chunk);
+                return;
+            }
+        }
+        ::operator delete(chunk);
+    }
+
+    size_t ChunkPool::chunks_allocated() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return allocated;
+    }
+
+    size_t ChunkPool::chunks_reused() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return reused;
+    }
+
+    /**
+     * @brief Handles requests that do not fit in the current chunk.
+     *
+     * Requests larger than a quarter of a chunk get their own block so that they do not
+     * waste the tail of the current chunk. Everything else starts a fresh chunk.
+     */
+    void *Arena::allocate_slow(size_t bytes, size_t alignment) {
+        if (bytes + alignment > pool.chunk_size() / 4) {
+            alignment = std::max(alignment, alignof(std::max_align_t));
+            void *block = ::operator new(bytes, std::align_val_t(alignment));
+            large_blocks.emplace_back(block, alignment);
+            stats_.large_allocations++;
+            stats_.bytes_allocated += bytes;
+            return block;
+        }
+
+        char *chunk = pool.acquire();
+        chunks.push_back(chunk);
+        stats_.chunks_used++;
+        cursor = chunk;
+        limit = chunk + pool.chunk_size();
+
+        // Allocation count was already bumped by allocate(); undo it before retrying.
+        stats_.allocations--;
+        return allocate(bytes, alignment);
+    }
+
+    std::string_view Arena::copy_string(std::string_view text) {
+        if (text.empty()) {
+            return {};
+        }
+        auto *memory = static_cast<char *>(allocate(text.size(), alignof(char)));
+        std::memcpy(memory, text.data(), text.size());
+        return {memory, text.size()};
+    }
+
+    void Arena::reset() {
+        for (auto it = cleanups.rbegin(); it != cleanups.rend(); ++it) {
+            it->destroy(it->object);
+        }
+        cleanups.clear();
+
+        for (char *chunk : chunks) {
+            pool.release(chunk);
+        }
+        chunks.clear();
+
+        for (auto &[block, alignment] : large_blocks) {
+            ::operator delete(block, std::align_val_t(alignment));
+        }
+        large_blocks.clear();
+
+        cursor = nullptr;
+        limit = nullptr;
+        stats_ = ArenaStats();
+    }
+
+} // namespace minidb
@@ -0,0 +1,207 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace minidb {
+
+    /**
+     * @class ChunkPool
+     * @brief Thread-safe cache of fixed-size memory chunks shared by all arenas.
+     *
+     * When an arena is reset or destroyed its chunks go back to the pool instead of the
+     * global heap, so the next query reuses them without calling malloc.
+     */
+    class ChunkPool {
+    public:
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+        static constexpr size_t DEFAULT_MAX_CACHED_CHUNKS = 256;
+
+        explicit ChunkPool(size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                           size_t max_cached_chunks = DEFAULT_MAX_CACHED_CHUNKS)
+                : chunk_size_(chunk_size), max_cached_chunks(max_cached_chunks) {}
+
+        ~ChunkPool();
+
+        ChunkPool(const ChunkPool &) = delete;
+        ChunkPool &operator=(const ChunkPool &) = delete;
+
+        /// @brief Process-wide pool used by arenas that are not given one explicitly.
+        static ChunkPool &global();
+
+        /**
+         * @brief Returns a chunk of chunk_size() bytes, reusing a cached one when possible.
+         */
+        char *acquire();
+
+        /**
+         * @brief Returns a chunk to the cache, or frees it if the cache is full.
+         */
+        void release(char *chunk);
+
+        size_t chunk_size() const { return chunk_size_; }
+
+        /// @brief Number of chunks that had to be allocated from the global heap.
+        size_t chunks_allocated() const;
+
+        /// @brief Number of acquire() calls served from the cache.
+        size_t chunks_reused() const;
+
+    private:
+        const size_t chunk_size_;
+        const size_t max_cached_chunks;
+        mutable std::mutex lock;
+        std::vector<char *> free_chunks;
+        size_t allocated = 0;
+        size_t reused = 0;
+    };
+
+    /**
+     * @struct ArenaStats
+     * @brief Allocation accounting for a single arena.
+     */
+    struct ArenaStats {
+        size_t allocations = 0;        ///< Number of allocate() calls
+        size_t bytes_allocated = 0;    ///< Bytes handed out, including alignment padding
+        size_t chunks_used = 0;        ///< Pool chunks taken by this arena
+        size_t large_allocations = 0;  ///< Oversized requests served by the global heap
+    };
+
+    /**
+     * @class Arena
+     * @brief Bump allocator that owns all memory of one query (or one parsed statement).
+     *
+     * Allocation is a pointer bump inside the current chunk. Nothing is freed individually:
+     * reset() or the destructor releases everything in one step. Objects with non-trivial
+     * destructors created through make() have their destructors run at that point, in
+     * reverse order of construction.
+     *
+     * An Arena is not thread-safe; use one per worker thread.
+     *
+     * @par Usage Example:
+     * @code
+     * Arena arena;
+     * auto* entry = arena.make<HashEntry>(key, 0);
+     * std::string_view name = arena.copy_string(token.text);
+     * std::vector<int64_t, ArenaAllocator<int64_t>> values{ArenaAllocator<int64_t>(&arena)};
+     * @endcode
+     */
+    class Arena {
+    public:
+        explicit Arena(ChunkPool &pool = ChunkPool::global()) : pool(pool) {}
+
+        ~Arena() { reset(); }
+
+        Arena(const Arena &) = delete;
+        Arena &operator=(const Arena &) = delete;
+
+        /**
+         * @brief Allocates uninitialized memory from the arena.
+         * @param bytes Number of bytes requested.
+         * @param alignment Required alignment, must be a power of two.
+         * @return Pointer valid until reset() or destruction.
+         */
+        void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+            stats_.allocations++;
+            auto current = reinterpret_cast<uintptr_t>(cursor);
+            uintptr_t aligned = (current + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            if (cursor != nullptr && aligned + bytes <= reinterpret_cast<uintptr_t>(limit)) {
+                stats_.bytes_allocated += (aligned - current) + bytes;
+                cursor = reinterpret_cast<char *>(aligned + bytes);
+                return reinterpret_cast<void *>(aligned);
+            }
+            return allocate_slow(bytes, alignment);
+        }
+
+        /**
+         * @brief Constructs an object inside the arena.
+         *
+         * The destructor, if it is non-trivial, runs when the arena is reset.
+         */
+        template<typename T, typename... Args>
+        T *make(Args &&... args) {
+            void *memory = allocate(sizeof(T), alignof(T));
+            T *object = new(memory) T(std::forward<Args>(args)...);
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                cleanups.push_back({[](void *p) { static_cast<T *>(p)->~T(); }, object});
+            }
+            return object;
+        }
+
+        /**
+         * @brief Copies a string into the arena.
+         * @return View over the arena-owned copy.
+         */
+        std::string_view copy_string(std::string_view text);
+
+        /**
+         * @brief Runs registered destructors and returns all memory to the pool.
+         *
+         * The arena can be reused afterwards. Statistics are cleared as well.
+         */
+        void reset();
+
+        const ArenaStats &stats() const { return stats_; }
+
+    private:
+        struct Cleanup {
+            void (*destroy)(void *);
+            void *object;
+        };
+
+        void *allocate_slow(size_t bytes, size_t alignment);
+
+        ChunkPool &pool;
+        std::vector<char *> chunks;
+        std::vector<std::pair<void *, size_t>> large_blocks;   ///< Block and its alignment
+        std::vector<Cleanup> cleanups;
+        char *cursor = nullptr;
+        char *limit = nullptr;
+        ArenaStats stats_;
+    };
+
+    /**
+     * @class ArenaAllocator
+     * @brief Standard allocator adapter so containers can place their storage in an Arena.
+     *
+     * deallocate() is a no-op; memory comes back when the arena is reset.
+     */
+    template<typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(Arena *arena) : arena(arena) {}
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+        T *allocate(size_t n) {
+            return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *, size_t) {}
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U> &other) const { return arena == other.arena; }
+
+        template<typename U>
+        bool operator!=(const ArenaAllocator<U> &other) const { return arena != other.arena; }
+
+    private:
+        template<typename U> friend class ArenaAllocator;
+
+        Arena *arena;
+    };
+
+} // namespace minidb
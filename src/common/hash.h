@@ -0,0 +1,27 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace minidb {
+
+    /**
+     * @brief Mixes a 64-bit integer into a well distributed 64-bit hash (MurmurHash3 finalizer).
+     *
+     * Both the high and the low bits are usable, so callers can take radix partitions
+     * from the top bits and hash table slots from the bottom bits of the same value.
+     */
+    inline uint64_t hash_int64(int64_t key) {
+        auto h = static_cast<uint64_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+} // namespace minidb
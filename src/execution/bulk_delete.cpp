@@ -0,0 +1,119 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file bulk_delete.cpp
+ * @brief Implementation of the set-oriented DELETE.
+ */
+
+#include "bulk_delete.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include "storage/table_page.h"
+
+namespace minidb {
+
+    DeleteSummary BulkDelete::execute(std::vector<RecordId> record_ids) {
+        std::sort(record_ids.begin(), record_ids.end(), [](const RecordId &a, const RecordId &b) {
+            return a.page_id != b.page_id ? a.page_id < b.page_id : a.slot < b.slot;
+        });
+        record_ids.erase(std::unique(record_ids.begin(), record_ids.end()), record_ids.end());
+
+        DeleteSummary summary;
+        std::vector<page_id_t> emptied_extents;
+        char page_data[PAGE_SIZE];
+        std::vector<uint16_t> slots;
+        std::vector<uint16_t> deleted_slots;
+
+        for (size_t begin = 0; begin < record_ids.size();) {
+            page_id_t page_id = record_ids[begin].page_id;
+            size_t end = begin;
+            slots.clear();
+            for (; end < record_ids.size() && record_ids[end].page_id == page_id; end++) {
+                slots.push_back(record_ids[end].slot);
+            }
+
+            if (disk_manager->read_page(page_id, page_data) != IOResult::SUCCESS) {
+                throw std::runtime_error("Failed to read page " + std::to_string(page_id) + " for DELETE");
+            }
+            TablePage page(page_data);
+            // Report only the rows that were live, so the summary matches what indexes hold.
+            deleted_slots.clear();
+            page.delete_records(slots, &deleted_slots);
+            for (uint16_t slot : deleted_slots) {
+                summary.deleted.push_back(RecordId{page_id, slot});
+            }
+            if (disk_manager->write_page(page_id, page_data) != IOResult::SUCCESS) {
+                throw std::runtime_error("Failed to write page " + std::to_string(page_id) + " for DELETE");
+            }
+            summary.pages_written++;
+
+            page_id_t extent_start = page_id - page_id % EXTENT_SIZE;
+            if (page.is_empty() && (emptied_extents.empty() || emptied_extents.back() != extent_start)) {
+                emptied_extents.push_back(extent_start);
+            }
+            begin = end;
+        }
+        summary.rows_deleted = summary.deleted.size();
+
+        for (page_id_t extent_start : emptied_extents) {
+            if (extent_is_empty(extent_start)) {
+                summary.freed_extents.push_back(extent_start);
+            }
+        }
+        if (extent_manager != nullptr && !summary.freed_extents.empty()) {
+            if (extent_manager->deallocate_extents(summary.freed_extents) != IOResult::SUCCESS) {
+                throw std::runtime_error("Failed to return emptied extents to the GAM");
+            }
+        }
+        return summary;
+    }
+
+    size_t BulkDelete::reclaim_slots(const DeleteSummary &summary) {
+        const std::vector<RecordId> &record_ids = summary.deleted;
+        char page_data[PAGE_SIZE];
+        std::vector<uint16_t> slots;
+        size_t pages_written = 0;
+
+        for (size_t begin = 0; begin < record_ids.size();) {
+            page_id_t page_id = record_ids[begin].page_id;
+            size_t end = begin;
+            slots.clear();
+            for (; end < record_ids.size() && record_ids[end].page_id == page_id; end++) {
+                slots.push_back(record_ids[end].slot);
+            }
+            begin = end;
+
+            page_id_t extent_start = page_id - page_id % EXTENT_SIZE;
+            if (std::binary_search(summary.freed_extents.begin(), summary.freed_extents.end(), extent_start)) {
+                continue;
+            }
+            if (disk_manager->read_page(page_id, page_data) != IOResult::SUCCESS) {
+                throw std::runtime_error("Failed to read page " + std::to_string(page_id) + " to reclaim slots");
+            }
+            TablePage(page_data).reclaim_slots(slots);
+            if (disk_manager->write_page(page_id, page_data) != IOResult::SUCCESS) {
+                throw std::runtime_error("Failed to write page " + std::to_string(page_id) + " to reclaim slots");
+            }
+            pages_written++;
+        }
+        return pages_written;
+    }
+
+    bool BulkDelete::extent_is_empty(page_id_t start_page_id) {
+        char page_data[PAGE_SIZE];
+        for (page_id_t page_id = start_page_id; page_id < start_page_id + EXTENT_SIZE; page_id++) {
+            if (disk_manager->read_page(page_id, page_data) != IOResult::SUCCESS) {
+                return false;
+            }
+            TablePage page(page_data);
+            if (page.get_page_type() != PageType::Data || !page.is_empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace minidb
@@ -0,0 +1,80 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "storage/disk_manager.h"
+#include "storage/extent_manager.h"
+#include "storage/record_id.h"
+
+namespace minidb {
+
+    /**
+     * @struct DeleteSummary
+     * @brief What a bulk delete changed, for the caller to finish index and space maintenance.
+     */
+    struct DeleteSummary {
+        size_t rows_deleted = 0;
+        size_t pages_written = 0;
+        // Every deleted row, sorted by page and slot, so index entries can be removed in one batch.
+        std::vector<RecordId> deleted;
+        // First page of every extent that no longer holds a live row. Already returned to the GAM.
+        std::vector<page_id_t> freed_extents;
+    };
+
+    /**
+     * @class BulkDelete
+     * @brief Set-oriented DELETE: removes all matching rows page by page instead of row by row.
+     *
+     * The record ids of every matching row are collected first and sorted once. Each
+     * affected page is then read, has all of its victims marked dead in one pass, and is
+     * written back once. Space is not compacted here; the page compacts itself the next
+     * time an insert or update needs the room. Extents left without any live row are
+     * returned to the GAM together with a single GAM write.
+     *
+     * @par Usage Example:
+     * @code
+     * BulkDelete bulk_delete(&disk_manager, &extent_manager);
+     * DeleteSummary summary = bulk_delete.execute(matching_record_ids);
+     * index.remove_all(summary.deleted);
+     * bulk_delete.reclaim_slots(summary);   // slot numbers may now be reused
+     * @endcode
+     */
+    class BulkDelete {
+    public:
+        /**
+         * @param disk_manager Reads and writes the table pages.
+         * @param extent_manager Receives freed extents. If null, empty extents are reported but not freed.
+         */
+        explicit BulkDelete(DiskManager *disk_manager, ExtentManager *extent_manager = nullptr)
+            : disk_manager(disk_manager), extent_manager(extent_manager) {}
+
+        /**
+         * @brief Deletes the given rows. Duplicates and rows that are already deleted are ignored.
+         * @throws std::runtime_error if a page cannot be read or written.
+         */
+        DeleteSummary execute(std::vector<RecordId> record_ids);
+
+        /**
+         * @brief Lets new rows reuse the slots of the deleted rows.
+         *
+         * Until this is called the deleted slots stay reserved, so a RecordId still held by an
+         * index cannot resolve to a new row. Call it once the index entries in summary.deleted
+         * are gone. Pages of freed extents are skipped.
+         *
+         * @return The number of pages written.
+         * @throws std::runtime_error if a page cannot be read or written.
+         */
+        size_t reclaim_slots(const DeleteSummary &summary);
+
+    private:
+        bool extent_is_empty(page_id_t start_page_id);
+
+        DiskManager *disk_manager;
+        ExtentManager *extent_manager;
+    };
+
+} // namespace minidb
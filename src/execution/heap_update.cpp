@@ -0,0 +1,26 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file heap_update.cpp
+ * @brief Decides when an UPDATE can skip index maintenance.
+ */
+
+#include "heap_update.h"
+#include <strings.h>
+
+namespace minidb {
+
+    bool update_touches_columns(const UpdateStatementNode &update, const std::vector<std::string> &indexed_columns) {
+        for (const auto &set : update.updates) {
+            for (const auto &column : indexed_columns) {
+                if (strcasecmp(set.column->name.c_str(), column.c_str()) == 0) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+} // namespace minidb
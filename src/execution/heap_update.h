@@ -0,0 +1,38 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "sql/ast.h"
+#include "storage/table_page.h"
+
+namespace minidb {
+
+    /**
+     * @brief Checks whether an UPDATE assigns to any of the given columns.
+     *
+     * Column names compare case-insensitively, as identifiers do everywhere else.
+     *
+     * @param update The parsed UPDATE statement.
+     * @param indexed_columns Every column that is part of an index on the target table.
+     */
+    bool update_touches_columns(const UpdateStatementNode &update, const std::vector<std::string> &indexed_columns);
+
+    /**
+     * @brief Decides whether the indexes of a table must be written for an updated row.
+     *
+     * A row that stayed in its slot (in place or heap-only) keeps its RecordId, so index
+     * entries are still valid unless an indexed column changed. A row that had to move
+     * to another page needs new index entries either way.
+     *
+     * @param result Where TablePage::update_record() placed the new version.
+     * @param touches_indexed_column Result of update_touches_columns() for the statement.
+     */
+    inline bool index_maintenance_required(UpdateResult result, bool touches_indexed_column) {
+        return touches_indexed_column || result == UpdateResult::NoSpace;
+    }
+
+} // namespace minidb
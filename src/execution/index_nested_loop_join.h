@@ -0,0 +1,118 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "storage/config.h"
+#include "storage/record_id.h"
+
+namespace minidb {
+
+    /**
+     * @struct JoinMatch
+     * @brief One output pair of an index join: an outer row position and the matching inner row.
+     */
+    struct JoinMatch {
+        uint32_t outer_row;
+        RecordId inner;
+    };
+
+    /**
+     * @class IndexNestedLoopJoin
+     * @brief Equi-join that probes an ordered index on the inner table for each outer key.
+     *
+     * Outer keys are collected into batches and sorted before probing, so the index is
+     * visited in key order:
+     * - The first key of a batch descends from the root. Each following key continues
+     *   from the previous cursor position with seek_forward(). Neighbouring keys usually
+     *   share the same root-to-leaf path and often the same leaf.
+     * - Duplicate outer keys reuse the matches of the previous key without touching the index.
+     * - The leaf for a key a few positions ahead is prefetched while the current key is probed.
+     *
+     * The Index type must provide:
+     * @code
+     * Cursor seek(int64_t key) const;   // first entry with entry key >= key
+     * void prefetch(int64_t key) const; // hint that a lookup for key is coming
+     * // Cursor: bool valid(); int64_t key(); RecordId record_id(); void next();
+     * //         void seek_forward(int64_t key);  // key >= current key
+     * @endcode
+     */
+    template<typename Index>
+    class IndexNestedLoopJoin {
+    public:
+        static constexpr size_t PREFETCH_DISTANCE = 4;
+
+        explicit IndexNestedLoopJoin(const Index &index, size_t batch_size = BATCH_SIZE)
+                : index(index), batch_size(std::max<size_t>(batch_size, 1)) {}
+
+        /**
+         * @brief Joins the outer keys against the index.
+         * @param outer_keys Join key of every outer row.
+         * @param outer_count Number of outer rows.
+         * @return All matches. Within each batch, matches are ordered by key.
+         */
+        std::vector<JoinMatch> join(const int64_t *outer_keys, size_t outer_count) {
+            std::vector<JoinMatch> matches;
+            std::vector<std::pair<int64_t, uint32_t>> batch;
+            batch.reserve(std::min(batch_size, outer_count));
+            for (size_t start = 0; start < outer_count; start += batch_size) {
+                size_t end = std::min(outer_count, start + batch_size);
+                batch.clear();
+                for (size_t row = start; row < end; ++row) {
+                    batch.emplace_back(outer_keys[row], static_cast<uint32_t>(row));
+                }
+                probe_sorted(batch, matches);
+            }
+            return matches;
+        }
+
+    private:
+        void probe_sorted(std::vector<std::pair<int64_t, uint32_t>> &batch, std::vector<JoinMatch> &matches) {
+            std::sort(batch.begin(), batch.end());
+
+            for (size_t i = 0; i < std::min(PREFETCH_DISTANCE, batch.size()); ++i) {
+                index.prefetch(batch[i].first);
+            }
+
+            auto cursor = index.seek(batch.front().first);
+            size_t previous_begin = matches.size();
+            size_t previous_end = previous_begin;
+            for (size_t i = 0; i < batch.size(); ++i) {
+                const auto [key, outer_row] = batch[i];
+                if (i + PREFETCH_DISTANCE < batch.size()) {
+                    index.prefetch(batch[i + PREFETCH_DISTANCE].first);
+                }
+
+                if (i > 0 && batch[i - 1].first == key) {
+                    // Same key as the previous outer row: copy its matches.
+                    for (size_t m = previous_begin; m < previous_end; ++m) {
+                        matches.push_back({outer_row, matches[m].inner});
+                    }
+                    previous_begin = previous_end;
+                    previous_end = matches.size();
+                    continue;
+                }
+
+                if (i > 0) {
+                    cursor.seek_forward(key);
+                }
+                previous_begin = matches.size();
+                while (cursor.valid() && cursor.key() == key) {
+                    matches.push_back({outer_row, cursor.record_id()});
+                    cursor.next();
+                }
+                previous_end = matches.size();
+            }
+        }
+
+        const Index &index;
+        size_t batch_size;
+    };
+
+} // namespace minidb
@@ -0,0 +1,258 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file materialized_view.cpp
+ * @brief Incremental maintenance of GROUP BY materialized views.
+ */
+
+#include "materialized_view.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <strings.h>
+
+namespace minidb {
+
+    namespace {
+
+        std::string normalize(const std::string &name) {
+            std::string lowered(name);
+            std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lowered;
+        }
+
+        bool is_function(const FunctionCallNode &call, const char *name) {
+            return strcasecmp(call.name.c_str(), name) == 0;
+        }
+
+        Value add_values(const Value &a, const Value &b, int64_t sign) {
+            if (std::holds_alternative<int64_t>(a) && std::holds_alternative<int64_t>(b)) {
+                return std::get<int64_t>(a) + sign * std::get<int64_t>(b);
+            }
+            auto to_double = [](const Value &value) -> double {
+                if (auto *i = std::get_if<int64_t>(&value)) return static_cast<double>(*i);
+                if (auto *d = std::get_if<double>(&value)) return *d;
+                throw std::runtime_error("SUM is only defined for numeric columns");
+            };
+            return to_double(a) + static_cast<double>(sign) * to_double(b);
+        }
+
+    } // namespace
+
+    bool MaterializedAggregateView::ValueLess::operator()(const Value &a, const Value &b) const {
+        auto cmp = compare_literals(a, b);
+        return cmp ? *cmp < 0 : a.index() < b.index();
+    }
+
+    bool MaterializedAggregateView::KeyLess::operator()(const std::vector<Value> &a, const std::vector<Value> &b) const {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), ValueLess());
+    }
+
+    MaterializedAggregateView::MaterializedAggregateView(const SelectStatementNode &query,
+                                                         std::vector<std::string> base_columns)
+        : columns(std::move(base_columns)) {
+        if (query.is_select_all || query.from_clause == nullptr) {
+            throw std::runtime_error("Materialized view must select explicit columns from a table");
+        }
+        if (!query.join_clause.empty() || query.where_clause != nullptr) {
+            throw std::runtime_error("Materialized views with JOIN or WHERE cannot be maintained incrementally");
+        }
+        if (query.group_by == nullptr || query.group_by->having_clause != nullptr) {
+            throw std::runtime_error("Materialized view must have a GROUP BY clause and no HAVING clause");
+        }
+        table = normalize(query.from_clause->name->name);
+
+        for (const auto &expression : query.group_by->expressions) {
+            group_columns.push_back(resolve_column(*expression));
+        }
+
+        for (const auto &column : query.columns) {
+            auto *call = dynamic_cast<const FunctionCallNode *>(column.expression.get());
+            if (call == nullptr) {
+                size_t base_column = resolve_column(*column.expression);
+                auto it = std::find(group_columns.begin(), group_columns.end(), base_column);
+                if (it == group_columns.end()) {
+                    throw std::runtime_error("Column " + columns[base_column] + " must appear in GROUP BY");
+                }
+                output.push_back({true, static_cast<size_t>(it - group_columns.begin())});
+                continue;
+            }
+
+            AggregateSpec spec{AggregateKind::COUNT, std::nullopt};
+            if (is_function(*call, "SUM")) spec.kind = AggregateKind::SUM;
+            else if (is_function(*call, "COUNT")) spec.kind = AggregateKind::COUNT;
+            else if (is_function(*call, "MIN")) spec.kind = AggregateKind::MIN;
+            else if (is_function(*call, "MAX")) spec.kind = AggregateKind::MAX;
+            else throw std::runtime_error("Unsupported aggregate in materialized view: " + call->name);
+
+            if (call->is_star_argument) {
+                if (spec.kind != AggregateKind::COUNT) {
+                    throw std::runtime_error(call->name + "(*) is not supported");
+                }
+            } else if (call->arguments.size() == 1) {
+                spec.column = resolve_column(*call->arguments[0]);
+            } else {
+                throw std::runtime_error(call->name + " expects exactly one argument");
+            }
+            output.push_back({false, aggregates.size()});
+            aggregates.push_back(spec);
+        }
+    }
+
+    size_t MaterializedAggregateView::resolve_column(const ExpressionNode &expression) const {
+        const IdentifierNode *identifier = dynamic_cast<const IdentifierNode *>(&expression);
+        if (auto *qualified = dynamic_cast<const QualifiedIdentifierNode *>(&expression)) {
+            identifier = qualified->name.get();
+        }
+        if (identifier == nullptr) {
+            throw std::runtime_error("Materialized views only support plain columns as GROUP BY keys and aggregate arguments");
+        }
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (strcasecmp(columns[i].c_str(), identifier->name.c_str()) == 0) {
+                return i;
+            }
+        }
+        throw std::runtime_error("Unknown column in materialized view: " + identifier->name);
+    }
+
+    void MaterializedAggregateView::apply_inserts(const ResultBatch &rows) {
+        for (const auto &row : rows) {
+            apply(row, 1);
+        }
+    }
+
+    void MaterializedAggregateView::apply_deletes(const ResultBatch &rows) {
+        for (const auto &row : rows) {
+            apply(row, -1);
+        }
+    }
+
+    void MaterializedAggregateView::apply(const ResultRow &row, int64_t sign) {
+        std::vector<Value> key;
+        key.reserve(group_columns.size());
+        for (size_t column : group_columns) {
+            key.push_back(row[column]);
+        }
+
+        auto it = groups.find(key);
+        if (it == groups.end()) {
+            if (sign < 0) {
+                throw std::runtime_error("Materialized view " + table + " got a delete for a row it never saw");
+            }
+            GroupState state;
+            state.aggregates.resize(aggregates.size());
+            it = groups.emplace(std::move(key), std::move(state)).first;
+        }
+
+        GroupState &group = it->second;
+        if (sign < 0) {
+            for (size_t i = 0; i < aggregates.size(); i++) {
+                const AggregateSpec &spec = aggregates[i];
+                if ((spec.kind == AggregateKind::MIN || spec.kind == AggregateKind::MAX)
+                    && group.aggregates[i].values.count(row[*spec.column]) == 0) {
+                    throw std::runtime_error("Materialized view " + table + " got a delete for a row it never saw");
+                }
+            }
+        }
+        group.rows += sign;
+        if (group.rows <= 0) {
+            groups.erase(it);
+            return;
+        }
+
+        for (size_t i = 0; i < aggregates.size(); i++) {
+            const AggregateSpec &spec = aggregates[i];
+            AggregateState &state = group.aggregates[i];
+            switch (spec.kind) {
+                case AggregateKind::COUNT:
+                    state.count += sign;
+                    break;
+                case AggregateKind::SUM:
+                    state.sum = add_values(state.sum, row[*spec.column], sign);
+                    break;
+                case AggregateKind::MIN:
+                case AggregateKind::MAX: {
+                    auto value = state.values.find(row[*spec.column]);
+                    if (sign > 0) {
+                        if (value == state.values.end()) state.values.emplace(row[*spec.column], 1);
+                        else value->second++;
+                    } else if (--value->second == 0) {
+                        state.values.erase(value);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    ResultBatch MaterializedAggregateView::rows() const {
+        ResultBatch result;
+        result.reserve(groups.size());
+        for (const auto &[key, group] : groups) {
+            ResultRow row;
+            row.reserve(output.size());
+            for (const OutputColumn &column : output) {
+                if (column.is_group_key) {
+                    row.push_back(key[column.index]);
+                    continue;
+                }
+                const AggregateState &state = group.aggregates[column.index];
+                switch (aggregates[column.index].kind) {
+                    case AggregateKind::COUNT:
+                        row.emplace_back(state.count);
+                        break;
+                    case AggregateKind::SUM:
+                        row.push_back(state.sum);
+                        break;
+                    case AggregateKind::MIN:
+                        row.push_back(state.values.begin()->first);
+                        break;
+                    case AggregateKind::MAX:
+                        row.push_back(state.values.rbegin()->first);
+                        break;
+                }
+            }
+            result.push_back(std::move(row));
+        }
+        return result;
+    }
+
+    MaterializedAggregateView &MaterializedViewRegistry::create(const CreateMaterializedViewStatementNode &statement,
+                                                                const std::vector<std::string> &base_columns,
+                                                                const ResultBatch &base_rows) {
+        std::string name = normalize(statement.view_name->name);
+        if (views.count(name) != 0) {
+            throw std::runtime_error("Materialized view already exists: " + statement.view_name->name);
+        }
+        auto view = std::make_unique<MaterializedAggregateView>(*statement.query, base_columns);
+        view->apply_inserts(base_rows);
+        return *views.emplace(name, std::move(view)).first->second;
+    }
+
+    const MaterializedAggregateView *MaterializedViewRegistry::find(const std::string &view_name) const {
+        auto it = views.find(normalize(view_name));
+        return it == views.end() ? nullptr : it->second.get();
+    }
+
+    void MaterializedViewRegistry::on_insert(const std::string &table, const ResultBatch &rows) {
+        std::string name = normalize(table);
+        for (auto &[view_name, view] : views) {
+            if (view->base_table() == name) {
+                view->apply_inserts(rows);
+            }
+        }
+    }
+
+    void MaterializedViewRegistry::on_delete(const std::string &table, const ResultBatch &rows) {
+        std::string name = normalize(table);
+        for (auto &[view_name, view] : views) {
+            if (view->base_table() == name) {
+                view->apply_deletes(rows);
+            }
+        }
+    }
+
+} // namespace minidb
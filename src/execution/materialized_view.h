@@ -0,0 +1,142 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "result_cursor.h"
+#include "sql/ast.h"
+
+namespace minidb {
+
+    /**
+     * @class MaterializedAggregateView
+     * @brief Stored result of a GROUP BY query, kept current from base-table deltas.
+     *
+     * Supports 'SELECT g1, ..., SUM(c), COUNT(c), COUNT(*), MIN(c), MAX(c) FROM t GROUP BY g1, ...'.
+     * Each inserted or deleted base row updates only its own group. SUM and COUNT are
+     * adjusted directly. MIN and MAX keep a count of every value in the group, so deleting
+     * the current minimum does not force a recompute. A group disappears when its last row
+     * is deleted. Refresh cost is therefore proportional to the number of changed rows.
+     *
+     * Deletes must be rows the view has seen, inserted and not deleted since. A delete whose
+     * group or MIN/MAX value the view does not hold throws instead of being ignored, since
+     * the view no longer matches its base table.
+     *
+     * @par Usage Example:
+     * @code
+     * MaterializedAggregateView view(*create->query, {"region", "amount"});
+     * view.apply_inserts(existing_rows);      // initial build
+     * view.apply_inserts(inserted_rows);      // on every base-table change
+     * ResultBatch result = view.rows();       // reads never touch the base table
+     * @endcode
+     */
+    class MaterializedAggregateView {
+    public:
+        /**
+         * @brief Compiles the view definition.
+         * @param query The view's SELECT.
+         * @param base_columns Column names of the base table, in the order rows are passed in.
+         * @throws std::runtime_error if the query cannot be maintained incrementally.
+         */
+        MaterializedAggregateView(const SelectStatementNode &query, std::vector<std::string> base_columns);
+
+        const std::string &base_table() const { return table; }
+
+        /// @brief Folds rows added to the base table into the view.
+        void apply_inserts(const ResultBatch &rows);
+
+        /**
+         * @brief Removes rows deleted from the base table from the view.
+         * @throws std::runtime_error if a row cannot have been inserted before. The rows before it were applied.
+         */
+        void apply_deletes(const ResultBatch &rows);
+
+        /// @brief The current view contents, one row per group in group-key order, columns in SELECT-list order.
+        ResultBatch rows() const;
+
+        size_t group_count() const { return groups.size(); }
+
+    private:
+        enum class AggregateKind {
+            SUM,
+            COUNT,
+            MIN,
+            MAX
+        };
+
+        struct AggregateSpec {
+            AggregateKind kind;
+            std::optional<size_t> column; // nullopt for COUNT(*)
+        };
+
+        // Where an output column comes from: a group key position or an aggregate position.
+        struct OutputColumn {
+            bool is_group_key;
+            size_t index;
+        };
+
+        struct ValueLess {
+            bool operator()(const Value &a, const Value &b) const;
+        };
+
+        struct KeyLess {
+            bool operator()(const std::vector<Value> &a, const std::vector<Value> &b) const;
+        };
+
+        struct AggregateState {
+            Value sum = int64_t{0};
+            int64_t count = 0;
+            std::map<Value, int64_t, ValueLess> values; // Only for MIN and MAX
+        };
+
+        struct GroupState {
+            int64_t rows = 0;
+            std::vector<AggregateState> aggregates;
+        };
+
+        size_t resolve_column(const ExpressionNode &expression) const;
+        void apply(const ResultRow &row, int64_t sign);
+
+        std::string table;
+        std::vector<std::string> columns;
+        std::vector<size_t> group_columns;
+        std::vector<AggregateSpec> aggregates;
+        std::vector<OutputColumn> output;
+        std::map<std::vector<Value>, GroupState, KeyLess> groups;
+    };
+
+    /**
+     * @class MaterializedViewRegistry
+     * @brief Owns the materialized views and routes base-table changes to the views that depend on them.
+     */
+    class MaterializedViewRegistry {
+    public:
+        /**
+         * @brief Creates a view from a parsed CREATE MATERIALIZED VIEW statement.
+         * @param base_rows The base table's rows at creation time; later changes arrive through on_insert/on_delete.
+         * @throws std::runtime_error if the name is taken or the query is not supported.
+         */
+        MaterializedAggregateView &create(const CreateMaterializedViewStatementNode &statement,
+                                          const std::vector<std::string> &base_columns, const ResultBatch &base_rows);
+
+        /// @return The view, or nullptr if there is none with that name.
+        const MaterializedAggregateView *find(const std::string &view_name) const;
+
+        void on_insert(const std::string &table, const ResultBatch &rows);
+
+        void on_delete(const std::string &table, const ResultBatch &rows);
+
+    private:
+        std::unordered_map<std::string, std::unique_ptr<MaterializedAggregateView>> views;
+    };
+
+} // namespace minidb
@@ -0,0 +1,21 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file operator_stats.cpp
+ * @brief Per-thread CPU clock for operator instrumentation.
+ */
+
+#include "operator_stats.h"
+#include <ctime>
+
+namespace minidb {
+
+    std::chrono::nanoseconds thread_cpu_time() {
+        timespec now{};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+        return std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec);
+    }
+
+} // namespace minidb
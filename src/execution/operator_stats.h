@@ -0,0 +1,162 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace minidb {
+
+    /**
+     * @struct OperatorStats
+     * @brief What one plan operator actually did, as reported by EXPLAIN ANALYZE.
+     */
+    struct OperatorStats {
+        uint64_t rows = 0;
+        uint64_t batches = 0;
+        // Inclusive of the operators the timed one drives.
+        std::chrono::nanoseconds wall_time{0};
+        std::chrono::nanoseconds cpu_time{0};
+        uint64_t pages_read = 0; // Read from disk
+        uint64_t pages_hit = 0;  // Found in memory
+        size_t memory_bytes = 0;
+        size_t peak_memory_bytes = 0;
+
+        void allocate(size_t bytes) {
+            memory_bytes += bytes;
+            if (memory_bytes > peak_memory_bytes) peak_memory_bytes = memory_bytes;
+        }
+
+        void release(size_t bytes) { memory_bytes -= bytes < memory_bytes ? bytes : memory_bytes; }
+    };
+
+    /**
+     * @brief CPU time consumed so far by the calling thread.
+     */
+    std::chrono::nanoseconds thread_cpu_time();
+
+    /**
+     * @class OperatorTimer
+     * @brief Adds the wall and CPU time of a scope to an operator's statistics.
+     *
+     * For coarse steps such as building a hash table or sorting a run, never single rows or
+     * batches. A null stats pointer disables timing; that is how plans run outside EXPLAIN ANALYZE.
+     */
+    class OperatorTimer {
+    public:
+        explicit OperatorTimer(OperatorStats *stats) : stats(stats) {
+            if (stats != nullptr) {
+                wall_start = std::chrono::steady_clock::now();
+                cpu_start = thread_cpu_time();
+            }
+        }
+
+        ~OperatorTimer() {
+            if (stats != nullptr) {
+                stats->wall_time += std::chrono::steady_clock::now() - wall_start;
+                stats->cpu_time += thread_cpu_time() - cpu_start;
+            }
+        }
+
+        OperatorTimer(const OperatorTimer &) = delete;
+        OperatorTimer &operator=(const OperatorTimer &) = delete;
+
+    private:
+        OperatorStats *stats;
+        std::chrono::steady_clock::time_point wall_start;
+        std::chrono::nanoseconds cpu_start{0};
+    };
+
+    /**
+     * @class TimedSource
+     * @brief Wraps a pipeline source, counting and timing the batches it pushes through the pipeline.
+     *
+     * Wall time is taken per batch. The thread CPU clock is a system call, too slow to read
+     * twice per batch, so CPU time is taken once over the whole run, from the first batch
+     * to finish(). Like OperatorTimer, a null stats pointer runs the pipeline untimed.
+     */
+    template<typename Pipeline>
+    class TimedSource {
+    public:
+        TimedSource(OperatorStats *stats, Pipeline pipeline) : stats(stats), pipeline(std::move(pipeline)) {}
+
+        template<typename Batch>
+        void produce(Batch &batch) {
+            if (stats == nullptr) {
+                pipeline.produce(batch);
+                return;
+            }
+            if (stats->batches++ == 0) {
+                cpu_start = thread_cpu_time();
+            }
+            stats->rows += batch.selected_count();
+            auto start = std::chrono::steady_clock::now();
+            pipeline.produce(batch);
+            stats->wall_time += std::chrono::steady_clock::now() - start;
+        }
+
+        void finish() {
+            if (stats == nullptr) {
+                pipeline.finish();
+                return;
+            }
+            if (stats->batches == 0) {
+                cpu_start = thread_cpu_time();
+            }
+            auto start = std::chrono::steady_clock::now();
+            pipeline.finish();
+            stats->wall_time += std::chrono::steady_clock::now() - start;
+            stats->cpu_time += thread_cpu_time() - cpu_start;
+        }
+
+        auto &sink() { return pipeline.sink(); }
+
+    private:
+        OperatorStats *stats;
+        Pipeline pipeline;
+        std::chrono::nanoseconds cpu_start{0};
+    };
+
+    /**
+     * @class CountingOperator
+     * @brief Pipeline pass-through that counts the tuples flowing into its consumer.
+     *
+     * A null stats pointer disables counting.
+     */
+    template<typename Consumer>
+    class CountingOperator {
+    public:
+        CountingOperator(OperatorStats *stats, Consumer consumer) : stats(stats), consumer(std::move(consumer)) {}
+
+        template<typename Tuple>
+        void consume(const Tuple &tuple) {
+            if (stats != nullptr) {
+                stats->rows++;
+            }
+            consumer.consume(tuple);
+        }
+
+        void finish() { consumer.finish(); }
+
+        auto &sink() { return consumer.sink(); }
+
+    private:
+        OperatorStats *stats;
+        Consumer consumer;
+    };
+
+    template<typename Pipeline>
+    TimedSource<Pipeline> make_timed(OperatorStats *stats, Pipeline pipeline) {
+        return TimedSource<Pipeline>(stats, std::move(pipeline));
+    }
+
+    template<typename Consumer>
+    CountingOperator<Consumer> make_counting(OperatorStats *stats, Consumer consumer) {
+        return CountingOperator<Consumer>(stats, std::move(consumer));
+    }
+
+} // namespace minidb
@@ -0,0 +1,163 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file parallel_hash_aggregate.cpp
+ * @brief Implementation of the thread-local pre-aggregation table and the two-phase parallel aggregator.
+ */
+
+#include "parallel_hash_aggregate.h"
+#include "common/hash.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace minidb {
+
+    namespace {
+
+        size_t next_power_of_two(size_t n) {
+            size_t power = 1;
+            while (power < n) power <<= 1;
+            return power;
+        }
+
+        size_t checked_partition_bits(size_t partition_bits) {
+            if (partition_bits > PreAggregationTable::MAX_PARTITION_BITS) {
+                throw std::invalid_argument("partition_bits must be at most " +
+                                            std::to_string(PreAggregationTable::MAX_PARTITION_BITS) + ", got " +
+                                            std::to_string(partition_bits));
+            }
+            return partition_bits;
+        }
+
+        size_t partition_of(uint64_t hash, size_t partition_bits) {
+            return partition_bits == 0 ? 0 : static_cast<size_t>(hash >> (64 - partition_bits));
+        }
+
+    } // namespace
+
+    PreAggregationTable::PreAggregationTable(size_t capacity, size_t partition_bits)
+            : slots(next_power_of_two(std::max<size_t>(capacity, 2))),
+              partition_shift(checked_partition_bits(partition_bits)),
+              partitions_(size_t(1) << partition_shift) {
+        mask = slots.size() - 1;
+        // Keep probe sequences short: flush at 75% fill instead of degrading.
+        max_fill = std::max<size_t>(1, slots.size() / 4 * 3);
+    }
+
+    void PreAggregationTable::add(int64_t key, int64_t value) {
+        size_t index = hash_int64(key) & mask;
+        while (true) {
+            Slot &slot = slots[index];
+            if (!slot.used) {
+                if (fill == max_fill) {
+                    flush();
+                    add(key, value);
+                    return;
+                }
+                slot.used = true;
+                slot.group = {key, value, 1};
+                fill++;
+                return;
+            }
+            if (slot.group.key == key) {
+                slot.group.sum += value;
+                slot.group.count++;
+                return;
+            }
+            index = (index + 1) & mask;
+        }
+    }
+
+    void PreAggregationTable::flush() {
+        if (fill == 0) return;
+        for (Slot &slot : slots) {
+            if (slot.used) {
+                partitions_[partition_of(hash_int64(slot.group.key), partition_shift)].push_back(slot.group);
+                slot.used = false;
+            }
+        }
+        fill = 0;
+        flushes++;
+    }
+
+    ParallelHashAggregator::ParallelHashAggregator(size_t thread_count, size_t partition_bits, size_t local_capacity)
+            : thread_count(std::max<size_t>(thread_count, 1)),
+              partition_bits(checked_partition_bits(partition_bits)),
+              local_capacity(local_capacity) {}
+
+    std::vector<AggregateGroup> ParallelHashAggregator::aggregate(const int64_t *keys, const int64_t *values,
+                                                                  size_t row_count) {
+        const size_t partition_count = size_t(1) << partition_bits;
+        std::vector<PreAggregationTable> tables;
+        tables.reserve(thread_count);
+        for (size_t t = 0; t < thread_count; ++t) {
+            tables.emplace_back(local_capacity, partition_bits);
+        }
+
+        // Phase 1: every worker pre-aggregates a contiguous slice of the input.
+        std::vector<std::thread> workers;
+        const size_t slice = (row_count + thread_count - 1) / thread_count;
+        for (size_t t = 0; t < thread_count; ++t) {
+            workers.emplace_back([&, t]() {
+                size_t begin = std::min(row_count, t * slice);
+                size_t end = std::min(row_count, begin + slice);
+                for (size_t row = begin; row < end; ++row) {
+                    tables[t].add(keys[row], values[row]);
+                }
+                tables[t].flush();
+            });
+        }
+        for (auto &worker : workers) worker.join();
+        workers.clear();
+
+        flushes = 0;
+        for (const auto &table : tables) flushes += table.flush_count();
+
+        // Phase 2: each partition is merged by a single worker, so no synchronization is needed
+        // beyond handing out partition numbers.
+        std::vector<std::vector<AggregateGroup>> merged(partition_count);
+        std::atomic<size_t> next_partition{0};
+        for (size_t t = 0; t < thread_count; ++t) {
+            workers.emplace_back([&]() {
+                for (size_t p = next_partition++; p < partition_count; p = next_partition++) {
+                    size_t input_size = 0;
+                    for (auto &table : tables) input_size += table.partitions()[p].size();
+                    if (input_size == 0) continue;
+
+                    std::vector<int64_t> slot_of_group(next_power_of_two(input_size * 2), -1);
+                    const size_t mask = slot_of_group.size() - 1;
+                    auto &out = merged[p];
+                    for (auto &table : tables) {
+                        for (const AggregateGroup &partial : table.partitions()[p]) {
+                            size_t index = hash_int64(partial.key) & mask;
+                            while (slot_of_group[index] != -1 && out[slot_of_group[index]].key != partial.key) {
+                                index = (index + 1) & mask;
+                            }
+                            if (slot_of_group[index] == -1) {
+                                slot_of_group[index] = static_cast<int64_t>(out.size());
+                                out.push_back(partial);
+                            } else {
+                                AggregateGroup &group = out[slot_of_group[index]];
+                                group.sum += partial.sum;
+                                group.count += partial.count;
+                            }
+                        }
+                    }
+                }
+            });
+        }
+        for (auto &worker : workers) worker.join();
+
+        std::vector<AggregateGroup> result;
+        for (auto &partition : merged) {
+            result.insert(result.end(), partition.begin(), partition.end());
+        }
+        return result;
+    }
+
+} // namespace minidb
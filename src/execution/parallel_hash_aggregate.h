@@ -0,0 +1,112 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace minidb {
+
+    /**
+     * @struct AggregateGroup
+     * @brief One GROUP BY group with its running SUM and COUNT.
+     */
+    struct AggregateGroup {
+        int64_t key;
+        int64_t sum;
+        int64_t count;
+    };
+
+    /**
+     * @class PreAggregationTable
+     * @brief Small, fixed-capacity open addressing table that one worker aggregates into.
+     *
+     * The table is sized to stay cache resident. When it fills up, its groups are flushed
+     * into radix partitions chosen by the top bits of the key hash, and the table starts
+     * over empty. Partial groups for the same key may therefore appear in several flushes;
+     * the merge phase combines them.
+     */
+    class PreAggregationTable {
+    public:
+        /// @brief Upper bound on partition_bits: 65,536 partitions is already far more than any merge phase can use.
+        static constexpr size_t MAX_PARTITION_BITS = 16;
+
+        /**
+         * @param capacity Number of slots, rounded up to a power of two.
+         * @param partition_bits log2 of the number of radix partitions.
+         * @throws std::invalid_argument if partition_bits exceeds MAX_PARTITION_BITS.
+         */
+        PreAggregationTable(size_t capacity, size_t partition_bits);
+
+        /// @brief Adds one input row to its group, flushing to the partitions if the table is full.
+        void add(int64_t key, int64_t value);
+
+        /// @brief Moves every group in the table into its radix partition and empties the table.
+        void flush();
+
+        /// @brief Groups flushed so far, one vector per radix partition.
+        std::vector<std::vector<AggregateGroup>> &partitions() { return partitions_; }
+
+        size_t flush_count() const { return flushes; }
+
+    private:
+        struct Slot {
+            AggregateGroup group;
+            bool used;
+        };
+
+        std::vector<Slot> slots;
+        size_t mask;
+        size_t max_fill;
+        size_t fill = 0;
+        size_t partition_shift;
+        size_t flushes = 0;
+        std::vector<std::vector<AggregateGroup>> partitions_;
+    };
+
+    /**
+     * @class ParallelHashAggregator
+     * @brief Two-phase parallel hash aggregation for SELECT key, SUM(value), COUNT(*) ... GROUP BY key.
+     *
+     * Phase 1: each worker scans its share of the input and pre-aggregates into its own
+     * PreAggregationTable, spilling overflowing groups to radix partitions.
+     *
+     * Phase 2: each radix partition is merged by exactly one worker, which combines that
+     * partition's buckets from every phase 1 worker. Partitions are disjoint in key space,
+     * so no locks or shared hash table are needed in either phase.
+     *
+     * @par Usage Example:
+     * @code
+     * ParallelHashAggregator aggregator(std::thread::hardware_concurrency());
+     * auto groups = aggregator.aggregate(keys.data(), values.data(), keys.size());
+     * @endcode
+     */
+    class ParallelHashAggregator {
+    public:
+        static constexpr size_t DEFAULT_PARTITION_BITS = 6;
+        static constexpr size_t DEFAULT_LOCAL_CAPACITY = 4096;
+
+        /// @throws std::invalid_argument if partition_bits exceeds PreAggregationTable::MAX_PARTITION_BITS.
+        explicit ParallelHashAggregator(size_t thread_count,
+                                        size_t partition_bits = DEFAULT_PARTITION_BITS,
+                                        size_t local_capacity = DEFAULT_LOCAL_CAPACITY);
+
+        /**
+         * @brief Aggregates the input and returns one AggregateGroup per distinct key, in no particular order.
+         */
+        std::vector<AggregateGroup> aggregate(const int64_t *keys, const int64_t *values, size_t row_count);
+
+        /// @brief Total number of pre-aggregation table flushes during the last aggregate() call.
+        size_t last_flush_count() const { return flushes; }
+
+    private:
+        size_t thread_count;
+        size_t partition_bits;
+        size_t local_capacity;
+        size_t flushes = 0;
+    };
+
+} // namespace minidb
@@ -0,0 +1,213 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <variant>
+#include "row_batch.h"
+#include "runtime_filter.h"
+
+namespace minidb {
+
+    /**
+     * @struct RowRef
+     * @brief A reference to one selected row of a RowBatch. This is the tuple type a scan pushes.
+     */
+    struct RowRef {
+        const RowBatch *batch;
+        uint32_t row;
+
+        const Value &value(column_id_t column) const { return batch->value(column, row); }
+
+        /// @brief Value of an integer column.
+        int64_t column(column_id_t column) const { return std::get<int64_t>(value(column)); }
+    };
+
+    /*
+     * Push-based pipeline operators.
+     *
+     * A producer drives its consumer by calling consume() for every tuple, and finish() once
+     * its input is exhausted. Every operator is a template over its consumer type, so a
+     * whole pipeline (scan -> filter -> project -> aggregate) is a single concrete type.
+     * The compiler inlines all consume() calls into the scan loop, which gives one fused
+     * loop per batch with no virtual calls and no intermediate materialization.
+     *
+     * Sources consume RowBatches and push only the rows in the batch's selection vector. The
+     * columns the pipeline reads must already be materialized in the batch; the table scan
+     * filling the batch decodes them for the rows it selected.
+     *
+     * Pipelines are built inside-out with the make_* helpers:
+     * @code
+     * auto pipeline = make_scan(
+     *         make_filter([](const RowRef& r) { return r.column(AGE) > 40; },
+     *         make_project([](const RowRef& r) { return r.column(SALARY); },
+     *         SumAggregate<int64_t>())));
+     * for (const auto& batch : batches) pipeline.produce(batch);
+     * pipeline.finish();
+     * int64_t total = pipeline.sink().sum;
+     * @endcode
+     */
+
+    /**
+     * @class ScanOperator
+     * @brief Pipeline source. Pushes every selected row of each batch to its consumer.
+     */
+    template<typename Consumer>
+    class ScanOperator {
+    public:
+        explicit ScanOperator(Consumer consumer) : consumer(std::move(consumer)) {}
+
+        void produce(const RowBatch &batch) {
+            for (uint32_t row : batch.selection()) {
+                consumer.consume(RowRef{&batch, row});
+            }
+        }
+
+        void finish() { consumer.finish(); }
+
+        /// @brief Returns the pipeline's final operator, where results accumulate.
+        auto &sink() { return consumer.sink(); }
+
+    private:
+        Consumer consumer;
+    };
+
+    /**
+     * @class RuntimeFilterScanOperator
+     * @brief Probe-side scan that applies a join's RuntimeFilter inside the scan loop.
+     *
+     * The key column of each batch is checked against the min/max range and bloom filter
+     * first, in a tight loop that only refines the batch's selection vector. Only the rows
+     * still selected are pushed to the consumer, so rows without a join partner are never
+     * seen by the rest of the pipeline.
+     */
+    template<typename Consumer>
+    class RuntimeFilterScanOperator {
+    public:
+        RuntimeFilterScanOperator(column_id_t key_column, const RuntimeFilter *filter, Consumer consumer)
+                : key_column(key_column), filter(filter), consumer(std::move(consumer)) {}
+
+        void produce(RowBatch &batch) {
+            size_t before = batch.selected_count();
+            if (filter->empty()) {
+                rows_dropped += before;
+                return;
+            }
+            size_t count = batch.refine([&](uint32_t row) {
+                return filter->might_contain(std::get<int64_t>(batch.value(key_column, row)));
+            });
+            rows_dropped += before - count;
+            for (uint32_t row : batch.selection()) {
+                consumer.consume(RowRef{&batch, row});
+            }
+        }
+
+        void finish() { consumer.finish(); }
+
+        auto &sink() { return consumer.sink(); }
+
+        /// @brief Rows removed by the runtime filter so far.
+        size_t dropped_row_count() const { return rows_dropped; }
+
+    private:
+        column_id_t key_column;
+        const RuntimeFilter *filter;
+        Consumer consumer;
+        size_t rows_dropped = 0;
+    };
+
+    /**
+     * @class FilterOperator
+     * @brief Forwards only the tuples for which the predicate holds.
+     */
+    template<typename Predicate, typename Consumer>
+    class FilterOperator {
+    public:
+        FilterOperator(Predicate predicate, Consumer consumer)
+                : predicate(std::move(predicate)), consumer(std::move(consumer)) {}
+
+        template<typename Tuple>
+        void consume(const Tuple &tuple) {
+            if (predicate(tuple)) {
+                consumer.consume(tuple);
+            }
+        }
+
+        void finish() { consumer.finish(); }
+
+        auto &sink() { return consumer.sink(); }
+
+    private:
+        Predicate predicate;
+        Consumer consumer;
+    };
+
+    /**
+     * @class ProjectOperator
+     * @brief Transforms each tuple and forwards the result. The output tuple type is whatever the projection returns.
+     */
+    template<typename Projection, typename Consumer>
+    class ProjectOperator {
+    public:
+        ProjectOperator(Projection projection, Consumer consumer)
+                : projection(std::move(projection)), consumer(std::move(consumer)) {}
+
+        template<typename Tuple>
+        void consume(const Tuple &tuple) {
+            consumer.consume(projection(tuple));
+        }
+
+        void finish() { consumer.finish(); }
+
+        auto &sink() { return consumer.sink(); }
+
+    private:
+        Projection projection;
+        Consumer consumer;
+    };
+
+    /**
+     * @struct SumAggregate
+     * @brief Pipeline sink computing SUM and COUNT of its input values.
+     */
+    template<typename T>
+    struct SumAggregate {
+        T sum = T();
+        int64_t count = 0;
+        bool finished = false;
+
+        void consume(T value) {
+            sum += value;
+            count++;
+        }
+
+        void finish() { finished = true; }
+
+        SumAggregate &sink() { return *this; }
+    };
+
+    template<typename Consumer>
+    ScanOperator<Consumer> make_scan(Consumer consumer) {
+        return ScanOperator<Consumer>(std::move(consumer));
+    }
+
+    template<typename Consumer>
+    RuntimeFilterScanOperator<Consumer> make_runtime_filter_scan(column_id_t key_column, const RuntimeFilter *filter,
+                                                                      Consumer consumer) {
+        return RuntimeFilterScanOperator<Consumer>(key_column, filter, std::move(consumer));
+    }
+
+    template<typename Predicate, typename Consumer>
+    FilterOperator<Predicate, Consumer> make_filter(Predicate predicate, Consumer consumer) {
+        return FilterOperator<Predicate, Consumer>(std::move(predicate), std::move(consumer));
+    }
+
+    template<typename Projection, typename Consumer>
+    ProjectOperator<Projection, Consumer> make_project(Projection projection, Consumer consumer) {
+        return ProjectOperator<Projection, Consumer>(std::move(projection), std::move(consumer));
+    }
+
+} // namespace minidb
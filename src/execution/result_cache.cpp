@@ -0,0 +1,158 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file result_cache.cpp
+ * @brief LRU result cache with table-version invalidation.
+ */
+
+#include "result_cache.h"
+#include <algorithm>
+#include <cctype>
+
+namespace minidb {
+
+    namespace {
+
+        std::string normalize(const std::string &name) {
+            std::string lowered(name);
+            std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lowered;
+        }
+
+        // Approximate heap footprint of a result, used for the memory bound.
+        size_t estimate_bytes(const ResultBatch &rows) {
+            size_t bytes = sizeof(ResultBatch) + rows.capacity() * sizeof(ResultRow);
+            for (const auto &row : rows) {
+                bytes += row.capacity() * sizeof(Value);
+                for (const auto &value : row) {
+                    if (auto *text = std::get_if<std::string>(&value)) {
+                        bytes += text->capacity();
+                    }
+                }
+            }
+            return bytes;
+        }
+
+    } // namespace
+
+    std::string ResultCacheKey::to_string() const {
+        std::string key = fingerprint;
+        for (const auto &[table, version] : table_versions) {
+            key += '\0';
+            key += table;
+            key += '@';
+            key += std::to_string(version);
+        }
+        return key;
+    }
+
+    uint64_t ResultCache::version_of(const std::string &table) const {
+        auto it = versions.find(table);
+        return it == versions.end() ? 0 : it->second;
+    }
+
+    ResultCacheKey ResultCache::make_key(const std::string &fingerprint, const std::vector<std::string> &tables) const {
+        ResultCacheKey key{fingerprint, {}};
+        std::lock_guard<std::mutex> guard(lock);
+        for (const auto &table : tables) {
+            std::string name = normalize(table);
+            key.table_versions.emplace_back(name, version_of(name));
+        }
+        std::sort(key.table_versions.begin(), key.table_versions.end());
+        return key;
+    }
+
+    std::shared_ptr<const ResultBatch> ResultCache::lookup(const ResultCacheKey &key) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = entries.find(key.to_string());
+        if (it == entries.end()) {
+            counters.misses++;
+            return nullptr;
+        }
+        lru.splice(lru.begin(), lru, it->second);
+        counters.hits++;
+        return it->second->rows;
+    }
+
+    void ResultCache::insert(const ResultCacheKey &key, ResultBatch rows) {
+        size_t bytes = estimate_bytes(rows) + key.fingerprint.size();
+        std::lock_guard<std::mutex> guard(lock);
+        if (bytes > max_bytes) {
+            return;
+        }
+        for (const auto &[table, version] : key.table_versions) {
+            if (version_of(table) != version) {
+                return; // The result was computed from data that has since changed.
+            }
+        }
+
+        std::string text = key.to_string();
+        auto existing = entries.find(text);
+        if (existing != entries.end()) {
+            erase(existing->second);
+        }
+        while (!lru.empty() && counters.bytes + bytes > max_bytes) {
+            erase(std::prev(lru.end()));
+            counters.evictions++;
+        }
+
+        Entry entry{text, {}, std::make_shared<const ResultBatch>(std::move(rows)), bytes};
+        for (const auto &table_version : key.table_versions) {
+            entry.tables.push_back(table_version.first);
+            dependents[table_version.first].insert(text);
+        }
+        lru.push_front(std::move(entry));
+        entries[text] = lru.begin();
+        counters.bytes += bytes;
+        counters.entries = entries.size();
+    }
+
+    void ResultCache::table_changed(const std::string &table) {
+        std::string name = normalize(table);
+        std::lock_guard<std::mutex> guard(lock);
+        versions[name]++;
+        auto it = dependents.find(name);
+        if (it == dependents.end()) {
+            return;
+        }
+        std::unordered_set<std::string> stale = std::move(it->second);
+        dependents.erase(it);
+        for (const auto &key : stale) {
+            auto entry = entries.find(key);
+            if (entry != entries.end()) {
+                erase(entry->second);
+                counters.invalidations++;
+            }
+        }
+    }
+
+    uint64_t ResultCache::table_version(const std::string &table) const {
+        std::lock_guard<std::mutex> guard(lock);
+        return version_of(normalize(table));
+    }
+
+    ResultCacheStats ResultCache::stats() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return counters;
+    }
+
+    void ResultCache::erase(EntryList::iterator entry) {
+        for (const auto &table : entry->tables) {
+            auto it = dependents.find(table);
+            if (it != dependents.end()) {
+                it->second.erase(entry->key);
+                if (it->second.empty()) {
+                    dependents.erase(it);
+                }
+            }
+        }
+        counters.bytes -= entry->bytes;
+        entries.erase(entry->key);
+        lru.erase(entry);
+        counters.entries = entries.size();
+    }
+
+} // namespace minidb
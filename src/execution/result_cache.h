@@ -0,0 +1,113 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "result_cursor.h"
+
+namespace minidb {
+
+    /**
+     * @struct ResultCacheStats
+     * @brief Counters reported by ResultCache::stats().
+     */
+    struct ResultCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;     // Entries dropped to stay under the memory bound
+        uint64_t invalidations = 0; // Entries dropped because a table they read changed
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+    /**
+     * @struct ResultCacheKey
+     * @brief A statement fingerprint together with the versions of the tables it reads.
+     *
+     * Take the key before executing the query. If a table changes while the query runs,
+     * the key is already stale and insert() will not cache the result.
+     */
+    struct ResultCacheKey {
+        std::string fingerprint;
+        std::vector<std::pair<std::string, uint64_t>> table_versions;
+
+        std::string to_string() const;
+    };
+
+    /**
+     * @class ResultCache
+     * @brief Optional cache of read-only query results, bounded in memory with LRU eviction.
+     *
+     * Entries are keyed by statement fingerprint (see statement_fingerprint()) and by the
+     * version counter of every table the statement reads. table_changed() bumps a table's
+     * version and drops the entries that read it, so a cached result is never served
+     * after a write. All methods are thread-safe.
+     *
+     * @par Usage Example:
+     * @code
+     * ResultCacheKey key = cache.make_key(statement_fingerprint(tokens), referenced_tables(*select));
+     * if (auto rows = cache.lookup(key)) return *rows;
+     * ResultBatch rows = execute(*select);
+     * cache.insert(key, rows);
+     * @endcode
+     */
+    class ResultCache {
+    public:
+        /**
+         * @param max_bytes Memory bound for cached results. 0 disables the cache.
+         */
+        explicit ResultCache(size_t max_bytes) : max_bytes(max_bytes) {}
+
+        /// @brief Builds the key for a statement from the current table versions.
+        ResultCacheKey make_key(const std::string &fingerprint, const std::vector<std::string> &tables) const;
+
+        /// @return The cached rows, or nullptr on a miss.
+        std::shared_ptr<const ResultBatch> lookup(const ResultCacheKey &key);
+
+        /**
+         * @brief Caches a result. Ignored if a table changed since the key was made, or if
+         * the result alone is larger than the memory bound.
+         */
+        void insert(const ResultCacheKey &key, ResultBatch rows);
+
+        /// @brief Records a write to a table and invalidates every entry that read it.
+        void table_changed(const std::string &table);
+
+        uint64_t table_version(const std::string &table) const;
+
+        ResultCacheStats stats() const;
+
+    private:
+        struct Entry {
+            std::string key;
+            std::vector<std::string> tables;
+            std::shared_ptr<const ResultBatch> rows;
+            size_t bytes;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        void erase(EntryList::iterator entry);
+        uint64_t version_of(const std::string &table) const;
+
+        const size_t max_bytes;
+        mutable std::mutex lock;
+        EntryList lru; // Most recently used first
+        std::unordered_map<std::string, EntryList::iterator> entries;
+        std::unordered_map<std::string, uint64_t> versions;
+        std::unordered_map<std::string, std::unordered_set<std::string>> dependents;
+        ResultCacheStats counters;
+    };
+
+} // namespace minidb
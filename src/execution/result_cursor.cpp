@@ -0,0 +1,95 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file result_cursor.cpp
+ * @brief Implementation of the bounded batch channel and the streaming result cursor.
+ */
+
+#include "result_cursor.h"
+
+namespace minidb {
+
+    bool BatchChannel::push(ResultBatch batch) {
+        std::unique_lock<std::mutex> guard(lock);
+        not_full.wait(guard, [this] { return cancelled || batches.size() < capacity; });
+        if (cancelled) {
+            return false;
+        }
+        batches.push_back(std::move(batch));
+        not_empty.notify_one();
+        return true;
+    }
+
+    std::optional<ResultBatch> BatchChannel::pop() {
+        std::unique_lock<std::mutex> guard(lock);
+        not_empty.wait(guard, [this] { return cancelled || finished || !batches.empty(); });
+        if (!batches.empty()) {
+            ResultBatch batch = std::move(batches.front());
+            batches.pop_front();
+            not_full.notify_one();
+            return batch;
+        }
+        if (error && !cancelled) {
+            std::exception_ptr failure = error;
+            error = nullptr;
+            std::rethrow_exception(failure);
+        }
+        return std::nullopt;
+    }
+
+    void BatchChannel::finish(std::exception_ptr failure) {
+        std::lock_guard<std::mutex> guard(lock);
+        finished = true;
+        error = failure;
+        not_empty.notify_all();
+    }
+
+    void BatchChannel::cancel() {
+        std::lock_guard<std::mutex> guard(lock);
+        cancelled = true;
+        batches.clear();
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+
+    ResultCursor::ResultCursor(Producer producer, size_t max_buffered_batches) : channel(max_buffered_batches) {
+        worker = std::thread([this, producer = std::move(producer)]() {
+            try {
+                producer([this](ResultBatch batch) { return channel.push(std::move(batch)); });
+                channel.finish();
+            } catch (...) {
+                channel.finish(std::current_exception());
+            }
+        });
+    }
+
+    ResultCursor::~ResultCursor() {
+        close();
+    }
+
+    bool ResultCursor::next(ResultBatch &out) {
+        if (closed) {
+            return false;
+        }
+        std::optional<ResultBatch> batch = channel.pop();
+        if (!batch) {
+            return false;
+        }
+        out = std::move(*batch);
+        return true;
+    }
+
+    void ResultCursor::close() {
+        if (closed) {
+            return;
+        }
+        closed = true;
+        channel.cancel();
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+} // namespace minidb
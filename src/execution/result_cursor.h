@@ -0,0 +1,122 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "row_batch.h"
+
+namespace minidb {
+
+    using ResultRow = std::vector<Value>;
+    using ResultBatch = std::vector<ResultRow>;
+
+    /**
+     * @class BatchChannel
+     * @brief Bounded queue of result batches between a query producer and its consumer.
+     *
+     * push() blocks while the queue is full, which throttles the producer to the speed of
+     * the consumer (backpressure) and bounds the memory held by undelivered results.
+     */
+    class BatchChannel {
+    public:
+        explicit BatchChannel(size_t capacity) : capacity(capacity == 0 ? 1 : capacity) {}
+
+        /**
+         * @brief Enqueues a batch, waiting for space if the queue is full.
+         * @return false if the consumer cancelled; the producer should stop.
+         */
+        bool push(ResultBatch batch);
+
+        /**
+         * @brief Dequeues the next batch, waiting for the producer if necessary.
+         * @return The batch, or nullopt once the producer has finished and the queue is drained.
+         * @throws Rethrows the producer's exception, if it failed.
+         */
+        std::optional<ResultBatch> pop();
+
+        /// @brief Called by the producer when it is done, with the exception it failed with, if any.
+        void finish(std::exception_ptr error = nullptr);
+
+        /// @brief Called by the consumer to stop the producer early. Pending batches are discarded.
+        void cancel();
+
+    private:
+        const size_t capacity;
+        std::mutex lock;
+        std::condition_variable not_full;
+        std::condition_variable not_empty;
+        std::deque<ResultBatch> batches;
+        std::exception_ptr error;
+        bool finished = false;
+        bool cancelled = false;
+    };
+
+    /**
+     * @class ResultCursor
+     * @brief Incremental access to a query's results, batch by batch, as they are produced.
+     *
+     * The query runs on its own thread and emits batches through a callback. The consumer
+     * receives the first batch as soon as it exists instead of after the whole result set
+     * has been materialized. At most `max_buffered_batches` batches are held at a time.
+     *
+     * @par Usage Example:
+     * @code
+     * ResultCursor cursor([&](const ResultCursor::Emit& emit) {
+     *     for (auto& batch : plan.batches()) {
+     *         if (!emit(std::move(batch))) return;   // client closed the cursor
+     *     }
+     * });
+     * ResultBatch batch;
+     * while (cursor.next(batch)) print(batch);
+     * @endcode
+     */
+    class ResultCursor {
+    public:
+        using Emit = std::function<bool(ResultBatch)>;
+        using Producer = std::function<void(const Emit &emit)>;
+
+        static constexpr size_t DEFAULT_BUFFERED_BATCHES = 2;
+
+        /**
+         * @brief Starts producing results in the background.
+         * @param producer Query body; it must stop when emit() returns false.
+         * @param max_buffered_batches Batches the producer may run ahead of the consumer.
+         */
+        explicit ResultCursor(Producer producer, size_t max_buffered_batches = DEFAULT_BUFFERED_BATCHES);
+
+        /// @brief Closes the cursor and waits for the producer to stop.
+        ~ResultCursor();
+
+        ResultCursor(const ResultCursor &) = delete;
+        ResultCursor &operator=(const ResultCursor &) = delete;
+
+        /**
+         * @brief Fetches the next batch of rows.
+         * @param out Receives the batch.
+         * @return false when the result set is exhausted or the cursor was closed.
+         * @throws Rethrows any exception raised by the producer.
+         */
+        bool next(ResultBatch &out);
+
+        /**
+         * @brief Stops the query early and releases buffered batches. Safe to call more than once.
+         */
+        void close();
+
+    private:
+        BatchChannel channel;
+        std::thread worker;
+        bool closed = false;
+    };
+
+} // namespace minidb
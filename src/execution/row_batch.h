@@ -0,0 +1,166 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "sql/ast.h"
+#include "storage/record_id.h"
+#include "selection_vector.h"
+
+namespace minidb {
+
+    using column_id_t = uint32_t;
+    using Value = LiteralValue;
+
+    /**
+     * @class RowBatch
+     * @brief A batch of rows carried through the pipeline as record ids plus a selection vector.
+     *
+     * Columns are decoded lazily (late materialization). A filter materializes only the
+     * columns it needs, and only for rows that are still selected. The remaining projected
+     * columns are fetched at the end of the pipeline for the rows that survived.
+     *
+     * Column values are stored densely by batch position, so shrinking the selection
+     * never invalidates columns that were already decoded.
+     *
+     * A fetcher is any callable with the signature
+     * `Value fetch(const RecordId& rid, column_id_t column)`.
+     *
+     * @par Usage Example:
+     * @code
+     * RowBatch batch(std::move(rids), table_column_count);
+     * batch.filter(AGE, fetch, [](const Value& v) { return std::get<int64_t>(v) > 40; });
+     * auto rows = batch.project({NAME, EMAIL}, fetch);   // decoded for survivors only
+     * @endcode
+     */
+    class RowBatch {
+    public:
+        /**
+         * @brief Creates a batch over the given rows with every row selected.
+         * @param record_ids Rows in this batch, typically one scan step.
+         * @param column_count Number of columns in the underlying table.
+         */
+        RowBatch(std::vector<RecordId> record_ids, size_t column_count)
+                : rids(std::move(record_ids)), sel(rids.size()), columns(column_count) {}
+
+        /// @brief Total number of rows in the batch, selected or not.
+        size_t row_count() const { return rids.size(); }
+
+        /// @brief Number of rows that are still selected.
+        size_t selected_count() const { return sel.size(); }
+
+        const SelectionVector &selection() const { return sel; }
+
+        const std::vector<RecordId> &record_ids() const { return rids; }
+
+        /// @brief Number of column values decoded so far. Useful to verify filtered rows were skipped.
+        size_t decoded_value_count() const { return decoded_values; }
+
+        bool is_materialized(column_id_t column) const { return !columns[column].empty(); }
+
+        /// @brief Value of a materialized column at a batch position.
+        const Value &value(column_id_t column, uint32_t row) const { return columns[column][row]; }
+
+        /**
+         * @brief Decodes a column for the currently selected rows.
+         *
+         * If the column was already decoded earlier in the pipeline, it is returned as is:
+         * it covers a superset of the current selection.
+         *
+         * @return Column values indexed by batch position. Unselected positions hold no meaningful value.
+         */
+        template<typename Fetcher>
+        const std::vector<Value> &materialize(column_id_t column, Fetcher &&fetch) {
+            auto &values = columns[column];
+            if (!values.empty()) {
+                return values;
+            }
+            values.resize(rids.size());
+            for (uint32_t row : sel) {
+                values[row] = fetch(rids[row], column);
+            }
+            decoded_values += sel.size();
+            return values;
+        }
+
+        /**
+         * @brief Decodes a single column and drops the rows whose value fails the predicate.
+         * @param pred Callable taking `const Value&` and returning bool.
+         * @return Number of rows still selected.
+         */
+        template<typename Fetcher, typename Predicate>
+        size_t filter(column_id_t column, Fetcher &&fetch, Predicate &&pred) {
+            const auto &values = materialize(column, fetch);
+            return sel.refine([&](uint32_t row) { return pred(values[row]); });
+        }
+
+        /**
+         * @brief Drops the selected rows for which the predicate fails, without decoding anything.
+         * @param pred Callable taking a batch position and returning bool.
+         * @return Number of rows still selected.
+         */
+        template<typename Predicate>
+        size_t refine(Predicate &&pred) {
+            return sel.refine(pred);
+        }
+
+        /**
+         * @brief Builds a new batch from the given positions of this batch.
+         *
+         * This is how joins carry rows forward: the probe side emits the positions that
+         * matched (a position may repeat for multiple matches). Columns that were already
+         * decoded are carried over, everything else stays lazy.
+         *
+         * @param positions Positions in this batch, each one must be currently selected.
+         */
+        RowBatch take(const std::vector<uint32_t> &positions) const {
+            std::vector<RecordId> out_rids;
+            out_rids.reserve(positions.size());
+            for (uint32_t row : positions) {
+                out_rids.push_back(rids[row]);
+            }
+            RowBatch out(std::move(out_rids), columns.size());
+            for (size_t c = 0; c < columns.size(); ++c) {
+                if (columns[c].empty()) continue;
+                out.columns[c].reserve(positions.size());
+                for (uint32_t row : positions) {
+                    out.columns[c].push_back(columns[c][row]);
+                }
+            }
+            return out;
+        }
+
+        /**
+         * @brief Produces the final output rows, decoding missing columns for survivors only.
+         * @param projection Columns to emit, in output order.
+         * @return One vector of values per selected row.
+         */
+        template<typename Fetcher>
+        std::vector<std::vector<Value>> project(const std::vector<column_id_t> &projection, Fetcher &&fetch) {
+            for (column_id_t column : projection) {
+                materialize(column, fetch);
+            }
+            std::vector<std::vector<Value>> rows;
+            rows.reserve(sel.size());
+            for (uint32_t row : sel) {
+                std::vector<Value> out_row;
+                out_row.reserve(projection.size());
+                for (column_id_t column : projection) {
+                    out_row.push_back(columns[column][row]);
+                }
+                rows.push_back(std::move(out_row));
+            }
+            return rows;
+        }
+
+    private:
+        std::vector<RecordId> rids;
+        SelectionVector sel;
+        std::vector<std::vector<Value>> columns;   ///< Dense per-column values, empty until materialized
+        size_t decoded_values = 0;
+    };
+
+} // namespace minidb
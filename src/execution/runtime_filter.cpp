@@ -0,0 +1,67 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file runtime_filter.cpp
+ * @brief Implementation of the split-block bloom filter and the join runtime filter.
+ */
+
+#include "runtime_filter.h"
+#include "common/hash.h"
+#include <algorithm>
+
+namespace minidb {
+
+    namespace {
+        // Odd multipliers from the Parquet split-block bloom filter specification.
+        constexpr uint32_t SALT[8] = {
+                0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+        };
+    } // namespace
+
+    BloomFilter::BloomFilter(size_t expected_keys, size_t bits_per_key) {
+        size_t wanted_blocks = std::max<size_t>(1, expected_keys * bits_per_key / (8 * sizeof(Block)));
+        size_t block_count = 1;
+        while (block_count < wanted_blocks) block_count <<= 1;
+        blocks.assign(block_count, Block{});
+        block_mask = block_count - 1;
+    }
+
+    uint32_t BloomFilter::bit_in_word(uint64_t hash, size_t word) {
+        auto low = static_cast<uint32_t>(hash);
+        return 1U << ((low * SALT[word]) >> 27);
+    }
+
+    void BloomFilter::insert(int64_t key) {
+        uint64_t hash = hash_int64(key);
+        Block &block = blocks[(hash >> 32) & block_mask];
+        for (size_t word = 0; word < block.size(); ++word) {
+            block[word] |= bit_in_word(hash, word);
+        }
+    }
+
+    bool BloomFilter::might_contain(int64_t key) const {
+        uint64_t hash = hash_int64(key);
+        const Block &block = block_for(hash);
+        // Combine all eight checks without early exits so the loop stays branch free.
+        uint32_t missing = 0;
+        for (size_t word = 0; word < block.size(); ++word) {
+            uint32_t bit = bit_in_word(hash, word);
+            missing |= (block[word] & bit) ^ bit;
+        }
+        return missing == 0;
+    }
+
+    RuntimeFilter RuntimeFilter::build(const int64_t *keys, size_t key_count) {
+        RuntimeFilter filter(key_count);
+        for (size_t i = 0; i < key_count; ++i) {
+            filter.bloom.insert(keys[i]);
+            filter.min_key = std::min(filter.min_key, keys[i]);
+            filter.max_key = std::max(filter.max_key, keys[i]);
+        }
+        return filter;
+    }
+
+} // namespace minidb
@@ -0,0 +1,92 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace minidb {
+
+    /**
+     * @class BloomFilter
+     * @brief Split-block bloom filter over 64-bit keys.
+     *
+     * Each key maps to one 32-byte block (half a cache line) and sets one bit in each of
+     * the block's eight 32-bit words. A lookup therefore touches a single block, which
+     * keeps probing cheap enough to run inside a scan loop.
+     */
+    class BloomFilter {
+    public:
+        static constexpr size_t DEFAULT_BITS_PER_KEY = 12;
+
+        /**
+         * @param expected_keys Number of keys that will be inserted.
+         * @param bits_per_key Space budget. 12 bits per key gives roughly a 1% false positive rate.
+         */
+        explicit BloomFilter(size_t expected_keys, size_t bits_per_key = DEFAULT_BITS_PER_KEY);
+
+        void insert(int64_t key);
+
+        /// @brief Returns false only if the key was definitely never inserted.
+        bool might_contain(int64_t key) const;
+
+        size_t size_in_bytes() const { return blocks.size() * sizeof(Block); }
+
+    private:
+        using Block = std::array<uint32_t, 8>;
+
+        const Block &block_for(uint64_t hash) const { return blocks[(hash >> 32) & block_mask]; }
+
+        static uint32_t bit_in_word(uint64_t hash, size_t word);
+
+        std::vector<Block> blocks;
+        uint64_t block_mask;
+    };
+
+    /**
+     * @class RuntimeFilter
+     * @brief Summary of a hash join's build-side keys, pushed down into the probe-side scan.
+     *
+     * Holds the min/max range and a bloom filter of the join keys. The probe-side scan drops
+     * rows whose key fails either check before they reach the join. The check may keep
+     * false positives but never drops a matching row.
+     *
+     * @par Usage Example:
+     * @code
+     * RuntimeFilter filter = RuntimeFilter::build(dim_keys.data(), dim_keys.size());
+     * auto scan = make_runtime_filter_scan(FACT_DIM_ID, &filter, probe_pipeline);
+     * @endcode
+     */
+    class RuntimeFilter {
+    public:
+        /**
+         * @brief Builds the filter from the build-side join keys.
+         */
+        static RuntimeFilter build(const int64_t *keys, size_t key_count);
+
+        bool might_contain(int64_t key) const {
+            return key >= min_key && key <= max_key && bloom.might_contain(key);
+        }
+
+        /// @brief True when the build side was empty; the probe side can then be skipped entirely.
+        bool empty() const { return key_count == 0; }
+
+        int64_t min() const { return min_key; }
+
+        int64_t max() const { return max_key; }
+
+    private:
+        explicit RuntimeFilter(size_t key_count) : bloom(key_count), key_count(key_count) {}
+
+        BloomFilter bloom;
+        size_t key_count;
+        int64_t min_key = std::numeric_limits<int64_t>::max();
+        int64_t max_key = std::numeric_limits<int64_t>::min();
+    };
+
+} // namespace minidb
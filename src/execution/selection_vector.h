@@ -0,0 +1,79 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace minidb {
+
+    /**
+     * @class SelectionVector
+     * @brief Ordered list of row positions within a batch that are still "alive".
+     *
+     * Filters never move or copy row data; they only shrink the selection vector.
+     * Downstream operators iterate over the selected positions and ignore the rest.
+     *
+     * @par Usage Example:
+     * @code
+     * SelectionVector sel(batch_size);          // every row selected
+     * sel.refine([&](uint32_t row) { return ages[row] > 40; });
+     * for (uint32_t row : sel) { ... }
+     * @endcode
+     */
+    class SelectionVector {
+    public:
+        /**
+         * @brief Creates a selection vector with rows [0, row_count) selected.
+         * @param row_count Number of rows in the batch.
+         */
+        explicit SelectionVector(size_t row_count) : indices(row_count) {
+            std::iota(indices.begin(), indices.end(), 0u);
+        }
+
+        /**
+         * @brief Creates a selection vector from an explicit, ascending list of row positions.
+         * @param selected Row positions to keep.
+         */
+        explicit SelectionVector(std::vector<uint32_t> selected) : indices(std::move(selected)) {}
+
+        /**
+         * @brief Keeps only the selected rows for which the predicate returns true.
+         *
+         * The loop is written without a data-dependent branch: every position is stored
+         * and the write cursor only advances when the predicate holds.
+         *
+         * @param pred Callable taking a row position and returning bool.
+         * @return Number of rows still selected.
+         */
+        template<typename Predicate>
+        size_t refine(Predicate &&pred) {
+            size_t out = 0;
+            for (size_t i = 0; i < indices.size(); ++i) {
+                uint32_t row = indices[i];
+                indices[out] = row;
+                out += pred(row) ? 1 : 0;
+            }
+            indices.resize(out);
+            return out;
+        }
+
+        size_t size() const { return indices.size(); }
+
+        bool empty() const { return indices.empty(); }
+
+        uint32_t operator[](size_t i) const { return indices[i]; }
+
+        std::vector<uint32_t>::const_iterator begin() const { return indices.begin(); }
+
+        std::vector<uint32_t>::const_iterator end() const { return indices.end(); }
+
+    private:
+        std::vector<uint32_t> indices;
+    };
+
+} // namespace minidb
@@ -0,0 +1,180 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file access_path.cpp
+ * @brief Chooses between sequential, index and bitmap-heap scans for a table.
+ */
+
+#include "access_path.h"
+#include <strings.h>
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include "cost_model.h"
+#include "selectivity.h"
+
+namespace minidb {
+
+    namespace {
+
+        // A comparison of one of the table's columns with a literal or a parameter.
+        struct Condition {
+            const ExpressionNode *expression;
+            std::string column;
+            std::string op;
+            IndexKey key;
+            double selectivity;
+        };
+
+        bool is_lower_bound(const std::string &op) { return op == ">" || op == ">="; }
+
+        bool is_upper_bound(const std::string &op) { return op == "<" || op == "<="; }
+
+        std::optional<std::string> own_column(const ExpressionNode *column, const JoinRelation &relation) {
+            if (auto *qualified = dynamic_cast<const QualifiedIdentifierNode *>(column)) {
+                const std::string &name = relation.alias.empty() ? relation.table : relation.alias;
+                if (strcasecmp(qualified->qualifier->name.c_str(), name.c_str()) != 0) {
+                    return std::nullopt;
+                }
+                return qualified->name->name;
+            }
+            return static_cast<const IdentifierNode *>(column)->name;
+        }
+
+        bool same_column(const std::string &a, const std::string &b) {
+            return strcasecmp(a.c_str(), b.c_str()) == 0;
+        }
+
+        /**
+         * Combined selectivity of AND-ed conditions. A lower and an upper bound on the same
+         * column describe one range, so their selectivities overlap rather than multiply:
+         * P(a < x < b) = P(x > a) + P(x < b) - 1.
+         */
+        double combined_selectivity(const std::vector<const Condition *> &conditions) {
+            double selectivity = 1;
+            std::map<std::string, std::pair<double, double>> ranges; // column -> (lower, upper) selectivity
+            for (const Condition *condition : conditions) {
+                if (is_lower_bound(condition->op) || is_upper_bound(condition->op)) {
+                    std::string key(condition->column);
+                    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return std::tolower(c); });
+                    auto &[lower, upper] = ranges.try_emplace(key, 1.0, 1.0).first->second;
+                    double &side = is_lower_bound(condition->op) ? lower : upper;
+                    side = std::min(side, condition->selectivity);
+                } else {
+                    selectivity *= condition->selectivity;
+                }
+            }
+            for (const auto &[column, range] : ranges) {
+                const auto &[lower, upper] = range;
+                selectivity *= lower < 1.0 && upper < 1.0 ? std::max(lower + upper - 1.0, DEFAULT_EQUALITY_SELECTIVITY)
+                                                          : lower * upper;
+            }
+            return selectivity;
+        }
+
+        // Keeps the tighter of the current bound and a new one. Returns false if the range
+        // does not imply the condition, which must then be checked on every row.
+        bool tighten(std::optional<IndexBound> &bound, const Condition &condition, bool is_lower) {
+            IndexBound candidate{condition.key, condition.op == ">=" || condition.op == "<="};
+            if (!bound) {
+                bound = candidate;
+                return true;
+            }
+            // A parameter's value is unknown until execution; keep the bound found first.
+            if (candidate.parameter || bound->parameter) {
+                return false;
+            }
+            auto cmp = compare_literals(candidate.value, bound->value);
+            if (!cmp) {
+                return false;
+            }
+            bool tighter = is_lower ? *cmp > 0 : *cmp < 0;
+            if (tighter || (*cmp == 0 && !candidate.inclusive)) {
+                bound = candidate;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    AccessPath choose_access_path(const JoinRelation &relation, const std::vector<const ExpressionNode *> &conditions,
+                                  const TableStatistics *statistics, const std::vector<IndexDefinition> &indexes) {
+        std::vector<Condition> usable;
+        for (const ExpressionNode *expression : conditions) {
+            std::optional<ColumnComparison> comparison = match_column_comparison(*expression);
+            if (!comparison) {
+                continue;
+            }
+            std::optional<std::string> column = own_column(comparison->column, relation);
+            if (!column) {
+                continue;
+            }
+            const ColumnStatistics *column_statistics = statistics ? statistics->column_statistics(*column) : nullptr;
+            double selectivity = comparison_selectivity(column_statistics, *comparison);
+            usable.push_back({expression, *column, comparison->op, IndexKey{comparison->value, comparison->parameter},
+                              selectivity});
+        }
+
+        std::vector<const Condition *> all;
+        for (const auto &condition : usable) all.push_back(&condition);
+        double rows = relation.table_rows * combined_selectivity(all);
+
+        AccessPath best;
+        best.rows = std::max(rows, std::min(relation.table_rows, 1.0));
+        best.cost = seq_scan_cost(relation.table_rows, static_cast<double>(usable.size()));
+        for (const auto &condition : usable) best.filter_conditions.push_back(condition.expression);
+
+        for (const auto &index : indexes) {
+            IndexKeyRange range;
+            std::vector<const Condition *> used;
+            // Equality on a prefix of the key, then at most one range column.
+            for (const auto &key_column : index.columns) {
+                auto equal = std::find_if(usable.begin(), usable.end(), [&](const Condition &condition) {
+                    return condition.op == "=" && same_column(condition.column, key_column);
+                });
+                if (equal != usable.end()) {
+                    range.equal_prefix.push_back(equal->key);
+                    used.push_back(&*equal);
+                    continue;
+                }
+                for (const auto &condition : usable) {
+                    if (!same_column(condition.column, key_column)) continue;
+                    if (is_lower_bound(condition.op) && tighten(range.lower, condition, true)) {
+                        used.push_back(&condition);
+                    } else if (is_upper_bound(condition.op) && tighten(range.upper, condition, false)) {
+                        used.push_back(&condition);
+                    }
+                }
+                break;
+            }
+            if (used.empty()) {
+                continue;
+            }
+
+            double matched = relation.table_rows * combined_selectivity(used);
+            double residual = static_cast<double>(usable.size() - used.size()) * matched * CPU_OPERATOR_COST;
+            double index_cost = index_scan_cost(relation.table_rows, matched) + residual;
+            double bitmap_cost = bitmap_heap_scan_cost(relation.table_rows, matched) + residual;
+            double cost = std::min(index_cost, bitmap_cost);
+            if (cost >= best.cost) {
+                continue;
+            }
+
+            AccessPath path;
+            path.method = index_cost <= bitmap_cost ? AccessMethod::INDEX_SCAN : AccessMethod::BITMAP_HEAP_SCAN;
+            path.index_name = index.name;
+            path.range = std::move(range);
+            for (const auto &condition : usable) {
+                bool answered = std::find(used.begin(), used.end(), &condition) != used.end();
+                (answered ? path.index_conditions : path.filter_conditions).push_back(condition.expression);
+            }
+            path.rows = best.rows;
+            path.cost = cost;
+            best = std::move(path);
+        }
+        return best;
+    }
+
+} // namespace minidb
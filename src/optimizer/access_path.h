@@ -0,0 +1,101 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "catalog/table_statistics.h"
+#include "join_order.h"
+#include "sql/ast.h"
+
+namespace minidb {
+
+    /**
+     * @enum AccessMethod
+     * @brief How a table's rows are read.
+     */
+    enum class AccessMethod {
+        SEQ_SCAN,        // Read every page
+        INDEX_SCAN,      // Walk the index range and fetch each row as it is found
+        BITMAP_HEAP_SCAN // Collect the index range's row ids, then read their pages in order
+    };
+
+    /**
+     * @struct IndexDefinition
+     * @brief An index available to the planner.
+     */
+    struct IndexDefinition {
+        std::string name;
+        std::vector<std::string> columns; // Key columns, most significant first
+    };
+
+    // Indexes of every table, keyed by lower-cased table name.
+    using IndexCatalog = std::unordered_map<std::string, std::vector<IndexDefinition>>;
+
+    /**
+     * @struct IndexKey
+     * @brief A key value of an index range: a literal, or a parameter bound at execution.
+     */
+    struct IndexKey {
+        LiteralValue value;
+        std::optional<size_t> parameter; // $n; `value` is unused when set
+    };
+
+    /**
+     * @struct IndexBound
+     * @brief One end of an index range.
+     */
+    struct IndexBound : IndexKey {
+        bool inclusive;
+    };
+
+    /**
+     * @struct IndexKeyRange
+     * @brief The index entries an access path reads: equality on a key prefix, then an
+     * optional range on the next key column.
+     */
+    struct IndexKeyRange {
+        std::vector<IndexKey> equal_prefix;
+        std::optional<IndexBound> lower;
+        std::optional<IndexBound> upper;
+    };
+
+    /**
+     * @struct AccessPath
+     * @brief The chosen way to read one table, with its estimates.
+     */
+    struct AccessPath {
+        AccessMethod method = AccessMethod::SEQ_SCAN;
+        std::string index_name; // Empty for SEQ_SCAN
+        IndexKeyRange range;
+        // Conditions answered by the index range.
+        std::vector<const ExpressionNode *> index_conditions;
+        // Conditions checked on every row read.
+        std::vector<const ExpressionNode *> filter_conditions;
+        double rows = 0; // Rows left after all conditions
+        double cost = 0;
+    };
+
+    /**
+     * @brief Chooses between a sequential scan and a scan of one of the table's indexes.
+     *
+     * An index is usable when the conditions fix its leading columns with '=' and optionally
+     * bound the next column with <, <=, > or >=. The matching conditions give the fraction of
+     * the index to read; the cost model then weighs the random reads of an index scan and a
+     * bitmap-heap scan against reading the whole table.
+     *
+     * @param relation The table, with its alias and row count.
+     * @param conditions AND-ed conditions of the query. Only comparisons of this table's columns
+     *                   with literals are considered; unqualified columns are taken to be this
+     *                   table's. Anything else is left for the caller to evaluate.
+     * @param statistics The table's statistics, or nullptr.
+     * @param indexes The table's indexes.
+     */
+    AccessPath choose_access_path(const JoinRelation &relation, const std::vector<const ExpressionNode *> &conditions,
+                                  const TableStatistics *statistics, const std::vector<IndexDefinition> &indexes);
+
+} // namespace minidb
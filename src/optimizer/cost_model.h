@@ -0,0 +1,120 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "storage/config.h"
+
+/**
+ * @file cost_model.h
+ * @brief Cost constants and formulas the planner uses to compare physical alternatives.
+ *
+ * Costs are in abstract units where reading one page sequentially costs 1.0.
+ */
+
+namespace minidb {
+
+    static constexpr double SEQ_PAGE_COST = 1.0;
+    static constexpr double RANDOM_PAGE_COST = 4.0;
+    static constexpr double CPU_TUPLE_COST = 0.01;
+    static constexpr double CPU_OPERATOR_COST = 0.0025;
+
+    // Default row width used until the catalog records per-table averages.
+    static constexpr double DEFAULT_ROW_WIDTH = 64.0;
+
+    // B+ tree entries per page, used to estimate index height.
+    static constexpr double INDEX_FANOUT = 256.0;
+
+    /**
+     * @enum JoinAlgorithm
+     * @brief Physical join algorithms the planner can choose from.
+     */
+    enum class JoinAlgorithm {
+        HASH_JOIN,
+        INDEX_NESTED_LOOP_JOIN
+    };
+
+    inline double estimate_pages(double rows) {
+        return std::max(1.0, std::ceil(rows * DEFAULT_ROW_WIDTH / PAGE_SIZE));
+    }
+
+    inline double estimate_index_height(double rows) {
+        return std::max(1.0, std::ceil(std::log(std::max(rows, 2.0)) / std::log(INDEX_FANOUT)));
+    }
+
+    /**
+     * @brief Hash join: scan the inner side once to build, then probe with every outer row.
+     */
+    inline double hash_join_cost(double outer_rows, double inner_rows) {
+        return estimate_pages(inner_rows) * SEQ_PAGE_COST
+               + inner_rows * (CPU_TUPLE_COST + CPU_OPERATOR_COST)
+               + outer_rows * (CPU_TUPLE_COST + CPU_OPERATOR_COST);
+    }
+
+    /**
+     * @brief Index nested-loop join with sorted, batched probes.
+     *
+     * Sorted probes share the upper levels of the tree, so each probe is charged one random
+     * leaf read plus the amortized descent. The cost can never exceed reading every leaf once.
+     */
+    inline double index_nested_loop_join_cost(double outer_rows, double inner_rows) {
+        double leaf_pages = estimate_pages(inner_rows);
+        double per_probe = RANDOM_PAGE_COST + CPU_OPERATOR_COST * estimate_index_height(inner_rows) * 8;
+        double io = std::min(outer_rows * per_probe, leaf_pages * RANDOM_PAGE_COST);
+        return io + outer_rows * CPU_TUPLE_COST;
+    }
+
+    /**
+     * @brief Full table scan, evaluating `filters` predicates on every row.
+     */
+    inline double seq_scan_cost(double table_rows, double filters) {
+        return estimate_pages(table_rows) * SEQ_PAGE_COST + table_rows * (CPU_TUPLE_COST + filters * CPU_OPERATOR_COST);
+    }
+
+    /**
+     * @brief Index range scan that fetches each matching row from the table as it is found.
+     *
+     * Matching rows are assumed to be scattered, so every fetch is a random page read.
+     */
+    inline double index_scan_cost(double table_rows, double matched_rows) {
+        double descent = estimate_index_height(table_rows) * RANDOM_PAGE_COST;
+        double leaf_pages = std::ceil(matched_rows / INDEX_FANOUT) * SEQ_PAGE_COST;
+        return descent + leaf_pages + matched_rows * (RANDOM_PAGE_COST + CPU_TUPLE_COST);
+    }
+
+    /**
+     * @brief Index range scan that collects matching row ids first, then reads each table page
+     * holding a match once, in page order.
+     *
+     * The page reads get cheaper as they get denser, approaching a sequential scan when most
+     * pages hold a match. Building and sorting the row ids is paid before the first row is
+     * returned, which makes a plain index scan the better choice for a handful of rows.
+     */
+    inline double bitmap_heap_scan_cost(double table_rows, double matched_rows) {
+        double table_pages = estimate_pages(table_rows);
+        // Expected distinct pages touched by matched_rows uniformly scattered rows.
+        double pages_fetched = table_pages * (1.0 - std::pow(1.0 - 1.0 / table_pages, matched_rows));
+        double page_cost = RANDOM_PAGE_COST - (RANDOM_PAGE_COST - SEQ_PAGE_COST) * std::sqrt(pages_fetched / table_pages);
+        double descent = estimate_index_height(table_rows) * RANDOM_PAGE_COST;
+        double leaf_pages = std::ceil(matched_rows / INDEX_FANOUT) * SEQ_PAGE_COST;
+        double bitmap = SEQ_PAGE_COST + matched_rows * std::log2(matched_rows + 1.0) * CPU_OPERATOR_COST;
+        return descent + leaf_pages + bitmap + pages_fetched * page_cost + matched_rows * CPU_TUPLE_COST;
+    }
+
+    /**
+     * @brief Picks the cheaper join algorithm for an equi-join.
+     * @param outer_rows Estimated rows on the outer (probe) side.
+     * @param inner_rows Estimated rows in the inner table.
+     * @param inner_has_index True if the inner join column has an ordered index.
+     */
+    inline JoinAlgorithm choose_join_algorithm(double outer_rows, double inner_rows, bool inner_has_index) {
+        if (inner_has_index && index_nested_loop_join_cost(outer_rows, inner_rows) < hash_join_cost(outer_rows, inner_rows)) {
+            return JoinAlgorithm::INDEX_NESTED_LOOP_JOIN;
+        }
+        return JoinAlgorithm::HASH_JOIN;
+    }
+
+} // namespace minidb
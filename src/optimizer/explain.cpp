@@ -0,0 +1,211 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file explain.cpp
+ * @brief Builds and renders the plan tree shown by EXPLAIN and EXPLAIN ANALYZE.
+ */
+
+#include "explain.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include "join_order.h"
+#include "selectivity.h"
+#include "sql/expression_rewriter.h"
+
+namespace minidb {
+
+    namespace {
+
+        std::string normalize(const std::string &name) {
+            std::string lowered(name);
+            std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lowered;
+        }
+
+        std::string display_name(const JoinRelation &relation) {
+            return relation.alias.empty() ? relation.table : relation.alias;
+        }
+
+        std::string join_conditions(const std::vector<const ExpressionNode *> &conditions) {
+            std::string text;
+            for (const ExpressionNode *condition : conditions) {
+                if (!text.empty()) text += " AND ";
+                text += expression_to_string(*condition);
+            }
+            return text;
+        }
+
+        std::unique_ptr<ExplainNode> describe_scan(const JoinRelation &relation, const AccessPath &path) {
+            auto node = std::make_unique<ExplainNode>();
+            std::string target = relation.table + (relation.alias.empty() ? "" : " " + relation.alias);
+            switch (path.method) {
+                case AccessMethod::SEQ_SCAN:
+                    node->title = "Seq Scan on " + target;
+                    break;
+                case AccessMethod::INDEX_SCAN:
+                    node->title = "Index Scan using " + path.index_name + " on " + target;
+                    break;
+                case AccessMethod::BITMAP_HEAP_SCAN:
+                    node->title = "Bitmap Heap Scan using " + path.index_name + " on " + target;
+                    break;
+            }
+            if (!path.index_conditions.empty()) {
+                node->details.push_back("Index Cond: " + join_conditions(path.index_conditions));
+            }
+            if (!path.filter_conditions.empty()) {
+                node->details.push_back("Filter: " + join_conditions(path.filter_conditions));
+            }
+            node->estimated_rows = path.rows;
+            node->estimated_cost = path.cost;
+            return node;
+        }
+
+        std::unique_ptr<ExplainNode> describe_join(const JoinPlan &plan, const JoinGraph &graph,
+                                                   const std::vector<AccessPath> &paths) {
+            if (plan.is_leaf()) {
+                return describe_scan(graph.relations[plan.relation], paths[plan.relation]);
+            }
+            auto node = std::make_unique<ExplainNode>();
+            node->title = plan.algorithm == JoinAlgorithm::HASH_JOIN ? "Hash Join" : "Index Nested Loop Join";
+            std::string condition;
+            for (const auto &predicate : graph.predicates) {
+                bool left_outer = plan.left->relations >> predicate.left & 1;
+                bool right_outer = plan.left->relations >> predicate.right & 1;
+                bool left_inner = plan.right->relations >> predicate.left & 1;
+                bool right_inner = plan.right->relations >> predicate.right & 1;
+                if ((left_outer && right_inner) || (right_outer && left_inner)) {
+                    if (!condition.empty()) condition += " AND ";
+                    condition += "(" + display_name(graph.relations[predicate.left]) + "." + predicate.left_column + " = "
+                                 + display_name(graph.relations[predicate.right]) + "." + predicate.right_column + ")";
+                }
+            }
+            node->details.push_back(condition.empty() ? "Join Cond: none (cross product)" : "Join Cond: " + condition);
+            node->estimated_rows = plan.rows;
+            node->estimated_cost = plan.cost;
+            node->children.push_back(describe_join(*plan.left, graph, paths));
+            node->children.push_back(describe_join(*plan.right, graph, paths));
+            return node;
+        }
+
+        std::unique_ptr<ExplainNode> wrap(std::unique_ptr<ExplainNode> input, std::string title, std::string detail,
+                                          double rows, double cost) {
+            auto node = std::make_unique<ExplainNode>();
+            node->title = std::move(title);
+            node->details.push_back(std::move(detail));
+            node->estimated_rows = rows;
+            node->estimated_cost = input->estimated_cost + cost;
+            node->children.push_back(std::move(input));
+            return node;
+        }
+
+        double to_ms(std::chrono::nanoseconds duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+
+        void render(const ExplainNode &node, bool analyze, const std::string &indent, bool is_child, std::string &out) {
+            char buffer[256];
+            std::snprintf(buffer, sizeof(buffer), "  (cost=%.2f rows=%.0f)", node.estimated_cost, node.estimated_rows);
+            out += indent + (is_child ? "->  " : "") + node.title + buffer;
+            if (analyze) {
+                const OperatorStats &actual = node.actual;
+                std::snprintf(buffer, sizeof(buffer), " (actual rows=%llu batches=%llu wall=%.3f ms cpu=%.3f ms)",
+                              static_cast<unsigned long long>(actual.rows), static_cast<unsigned long long>(actual.batches),
+                              to_ms(actual.wall_time), to_ms(actual.cpu_time));
+                out += buffer;
+            }
+            out += "\n";
+
+            std::string detail_indent = indent + (is_child ? "      " : "  ");
+            for (const auto &detail : node.details) {
+                out += detail_indent + detail + "\n";
+            }
+            // Only the operators that touch pages or hold memory fill these in; the rest leave the line out.
+            const OperatorStats &actual = node.actual;
+            if (analyze && (actual.pages_read != 0 || actual.pages_hit != 0 || actual.peak_memory_bytes != 0)) {
+                std::snprintf(buffer, sizeof(buffer), "Pages: read=%llu hit=%llu  Memory: %.1f kB",
+                              static_cast<unsigned long long>(actual.pages_read),
+                              static_cast<unsigned long long>(actual.pages_hit), actual.peak_memory_bytes / 1024.0);
+                out += detail_indent + buffer + "\n";
+            }
+            for (const auto &child : node.children) {
+                render(*child, analyze, is_child ? indent + "      " : indent + "  ", true, out);
+            }
+        }
+
+    } // namespace
+
+    std::unique_ptr<ExplainNode> explain_select(const SelectStatementNode &select, const StatisticsCatalog &catalog,
+                                                const IndexCatalog &indexes) {
+        JoinGraph graph = build_join_graph(select, catalog);
+        if (graph.relations.empty()) {
+            throw std::runtime_error("EXPLAIN needs a query with a FROM clause");
+        }
+
+        std::vector<const ExpressionNode *> conditions = split_conjuncts(select.where_clause.get());
+        for (const auto &join : select.join_clause) {
+            std::vector<const ExpressionNode *> on = split_conjuncts(join.on_condition.get());
+            conditions.insert(conditions.end(), on.begin(), on.end());
+        }
+        if (graph.relations.size() > 1) {
+            // Unqualified columns cannot be attributed to a table without the schema.
+            conditions.erase(std::remove_if(conditions.begin(), conditions.end(), [](const ExpressionNode *condition) {
+                auto comparison = match_column_comparison(*condition);
+                return comparison && dynamic_cast<const QualifiedIdentifierNode *>(comparison->column) == nullptr;
+            }), conditions.end());
+        }
+
+        std::vector<AccessPath> paths;
+        static const std::vector<IndexDefinition> no_indexes;
+        for (auto &relation : graph.relations) {
+            std::optional<TableStatistics> statistics = catalog.get(relation.table);
+            auto table_indexes = indexes.find(normalize(relation.table));
+            AccessPath path = choose_access_path(relation, conditions, statistics ? &*statistics : nullptr,
+                                                 table_indexes != indexes.end() ? table_indexes->second : no_indexes);
+            relation.rows = path.rows;
+            relation.scan_cost = path.cost;
+            paths.push_back(std::move(path));
+        }
+
+        std::unique_ptr<JoinPlan> plan = optimize_join_order(graph);
+        std::unique_ptr<ExplainNode> root = describe_join(*plan, graph, paths);
+
+        bool has_aggregate = std::any_of(select.columns.begin(), select.columns.end(), [](const auto &column) {
+            return dynamic_cast<const FunctionCallNode *>(column.expression.get()) != nullptr;
+        });
+        if (select.group_by != nullptr || has_aggregate) {
+            double input = root->estimated_rows;
+            std::string keys;
+            if (select.group_by != nullptr) {
+                for (const auto &expression : select.group_by->expressions) {
+                    keys += (keys.empty() ? "" : ", ") + expression_to_string(*expression);
+                }
+            }
+            double groups = select.group_by != nullptr ? std::min(input, DEFAULT_GROUP_COUNT) : 1.0;
+            root = wrap(std::move(root), "Aggregate", keys.empty() ? "Group Key: none" : "Group Key: " + keys,
+                        groups, input * CPU_OPERATOR_COST);
+        }
+        if (!select.order_by.empty()) {
+            double rows = root->estimated_rows;
+            std::string keys;
+            for (const auto &key : select.order_by) {
+                keys += (keys.empty() ? "" : ", ") + expression_to_string(*key.expression) + (key.is_ascending ? "" : " DESC");
+            }
+            root = wrap(std::move(root), "Sort", "Sort Key: " + keys, rows,
+                        rows * std::log2(std::max(rows, 2.0)) * CPU_OPERATOR_COST);
+        }
+        return root;
+    }
+
+    std::string format_explain(const ExplainNode &root, bool analyze) {
+        std::string out;
+        render(root, analyze, "", false, out);
+        return out;
+    }
+
+} // namespace minidb
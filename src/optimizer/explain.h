@@ -0,0 +1,53 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "access_path.h"
+#include "catalog/table_statistics.h"
+#include "execution/operator_stats.h"
+#include "sql/ast.h"
+
+namespace minidb {
+
+    // Groups assumed for GROUP BY when there are no statistics to go by.
+    static constexpr double DEFAULT_GROUP_COUNT = 200.0;
+
+    /**
+     * @struct ExplainNode
+     * @brief One operator of a plan as shown by EXPLAIN.
+     */
+    struct ExplainNode {
+        std::string title;                // e.g. "Index Scan using orders_customer on orders o"
+        std::vector<std::string> details; // e.g. "Index Cond: (o.customer_id = 42)"
+        double estimated_rows = 0;
+        double estimated_cost = 0;        // Including the operator's inputs
+        std::vector<std::unique_ptr<ExplainNode>> children;
+        // Filled in by the operator while EXPLAIN ANALYZE runs the plan.
+        OperatorStats actual;
+    };
+
+    /**
+     * @brief Plans a SELECT and describes the chosen plan.
+     *
+     * Each table gets its access path from choose_access_path(), and the tables are joined
+     * in the order chosen by optimize_join_order() over those access paths. Aggregation and
+     * sorting are added on top when the query asks for them.
+     *
+     * @param indexes Indexes available to the planner.
+     */
+    std::unique_ptr<ExplainNode> explain_select(const SelectStatementNode &select, const StatisticsCatalog &catalog,
+                                                const IndexCatalog &indexes);
+
+    /**
+     * @brief Renders a plan tree, one operator per line with its estimates.
+     * @param analyze Also print what each operator actually did: rows, batches, wall and CPU
+     *                time, and pages read and hit and peak memory for operators that report them.
+     */
+    std::string format_explain(const ExplainNode &root, bool analyze);
+
+} // namespace minidb
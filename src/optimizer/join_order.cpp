@@ -0,0 +1,377 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file join_order.cpp
+ * @brief Cost-based join ordering: DPccp for small queries, greedy ordering for large ones.
+ */
+
+#include "join_order.h"
+#include <strings.h>
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "selectivity.h"
+#include "sql/expression_rewriter.h"
+
+namespace minidb {
+
+    namespace {
+
+        constexpr size_t MAX_RELATIONS = 64;
+
+        struct ColumnRef {
+            size_t relation;
+            std::string column;
+        };
+
+        std::optional<ColumnRef> resolve_column(const ExpressionNode *expression, const std::vector<JoinRelation> &relations) {
+            if (auto *qualified = dynamic_cast<const QualifiedIdentifierNode *>(expression)) {
+                const std::string &qualifier = qualified->qualifier->name;
+                for (size_t i = 0; i < relations.size(); i++) {
+                    const JoinRelation &relation = relations[i];
+                    const std::string &name = relation.alias.empty() ? relation.table : relation.alias;
+                    if (strcasecmp(name.c_str(), qualifier.c_str()) == 0) {
+                        return ColumnRef{i, qualified->name->name};
+                    }
+                }
+                return std::nullopt;
+            }
+            auto *identifier = dynamic_cast<const IdentifierNode *>(expression);
+            if (identifier != nullptr && relations.size() == 1) {
+                return ColumnRef{0, identifier->name};
+            }
+            return std::nullopt;
+        }
+
+        double distinct_values(const std::optional<TableStatistics> &statistics, const std::string &column, double table_rows) {
+            const ColumnStatistics *column_statistics = statistics ? statistics->column_statistics(column) : nullptr;
+            // Without statistics, assume the column is a key.
+            return column_statistics != nullptr ? column_statistics->distinct_count : table_rows;
+        }
+
+        const char *algorithm_name(JoinAlgorithm algorithm) {
+            switch (algorithm) {
+                case JoinAlgorithm::HASH_JOIN:
+                    return "HASH_JOIN";
+                case JoinAlgorithm::INDEX_NESTED_LOOP_JOIN:
+                    return "INDEX_NESTED_LOOP_JOIN";
+            }
+            return "JOIN";
+        }
+
+        /**
+         * Memo of the best plan found for every set of relations, plus the two enumeration strategies.
+         */
+        class JoinOptimizer {
+        public:
+            explicit JoinOptimizer(const JoinGraph &graph) : graph(graph), neighbors(graph.relations.size(), 0) {
+                for (const auto &predicate : graph.predicates) {
+                    neighbors[predicate.left] |= bit(predicate.right);
+                    neighbors[predicate.right] |= bit(predicate.left);
+                }
+                connect_components();
+                for (size_t i = 0; i < graph.relations.size(); i++) {
+                    const JoinRelation &relation = graph.relations[i];
+                    double scan_cost = relation.scan_cost.value_or(estimate_pages(relation.table_rows) * SEQ_PAGE_COST
+                                                                   + relation.table_rows * CPU_TUPLE_COST);
+                    best[bit(i)] = Entry{relation.rows, scan_cost, 0, 0, JoinAlgorithm::HASH_JOIN};
+                }
+            }
+
+            // DPccp: enumerates every connected subgraph S1 and, for each, every connected
+            // subgraph S2 adjacent to it, in an order where the plans of both are already known.
+            std::unique_ptr<JoinPlan> dynamic_programming() {
+                size_t n = graph.relations.size();
+                for (size_t i = n; i-- > 0;) {
+                    emit_csg(bit(i));
+                    enumerate_csg(bit(i), below_or_equal(i));
+                }
+                return build(all());
+            }
+
+            std::unique_ptr<JoinPlan> greedy() {
+                std::vector<uint64_t> plans;
+                for (size_t i = 0; i < graph.relations.size(); i++) plans.push_back(bit(i));
+
+                while (plans.size() > 1) {
+                    size_t best_i = 0, best_j = 1;
+                    double best_rows = -1;
+                    double best_cost = 0;
+                    for (size_t i = 0; i < plans.size(); i++) {
+                        for (size_t j = i + 1; j < plans.size(); j++) {
+                            if ((neighborhood(plans[i]) & plans[j]) == 0) continue;
+                            uint64_t joined = plans[i] | plans[j];
+                            double rows = estimate_rows(joined);
+                            double cost = best[plans[i]].cost + best[plans[j]].cost;
+                            if (best_rows < 0 || rows < best_rows || (rows == best_rows && cost < best_cost)) {
+                                best_i = i, best_j = j, best_rows = rows, best_cost = cost;
+                            }
+                        }
+                    }
+                    consider(plans[best_i], plans[best_j]);
+                    plans[best_i] |= plans[best_j];
+                    plans.erase(plans.begin() + static_cast<long>(best_j));
+                }
+                return build(all());
+            }
+
+        private:
+            struct Entry {
+                double rows;
+                double cost;
+                uint64_t outer; // 0 for a leaf
+                uint64_t inner;
+                JoinAlgorithm algorithm;
+            };
+
+            static uint64_t bit(size_t i) { return uint64_t{1} << i; }
+
+            static uint64_t below_or_equal(size_t i) { return i + 1 == 64 ? ~uint64_t{0} : bit(i + 1) - 1; }
+
+            static size_t lowest(uint64_t set) { return static_cast<size_t>(__builtin_ctzll(set)); }
+
+            uint64_t all() const { return below_or_equal(graph.relations.size() - 1); }
+
+            uint64_t neighborhood(uint64_t set) const {
+                uint64_t result = 0;
+                for (uint64_t rest = set; rest != 0; rest &= rest - 1) {
+                    result |= neighbors[lowest(rest)];
+                }
+                return result & ~set;
+            }
+
+            // Links disconnected parts of the graph so that they are joined by cross product.
+            void connect_components() {
+                uint64_t reached = 0;
+                std::optional<size_t> previous;
+                for (size_t i = 0; i < graph.relations.size(); i++) {
+                    if (reached & bit(i)) continue;
+                    uint64_t component = bit(i);
+                    for (uint64_t frontier = component; frontier != 0;) {
+                        frontier = neighborhood(component);
+                        component |= frontier;
+                    }
+                    if (previous) {
+                        neighbors[*previous] |= bit(i);
+                        neighbors[i] |= bit(*previous);
+                    }
+                    previous = i;
+                    reached |= component;
+                }
+            }
+
+            double estimate_rows(uint64_t set) const {
+                double rows = 1;
+                for (uint64_t rest = set; rest != 0; rest &= rest - 1) {
+                    rows *= graph.relations[lowest(rest)].rows;
+                }
+                for (const auto &predicate : graph.predicates) {
+                    if ((set & bit(predicate.left)) && (set & bit(predicate.right))) {
+                        rows *= predicate.selectivity;
+                    }
+                }
+                return std::max(rows, 1.0);
+            }
+
+            // True if `inner` is one relation with an index on a column it is joined on with `outer`.
+            bool can_probe_index(uint64_t outer, uint64_t inner) const {
+                if ((inner & (inner - 1)) != 0) {
+                    return false;
+                }
+                size_t relation = lowest(inner);
+                for (const auto &predicate : graph.predicates) {
+                    if ((predicate.right == relation && predicate.right_indexed && (outer & bit(predicate.left)))
+                        || (predicate.left == relation && predicate.left_indexed && (outer & bit(predicate.right)))) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Costs joining two disjoint plans both ways round and keeps the cheapest.
+            void consider(uint64_t first, uint64_t second) {
+                auto first_plan = best.find(first);
+                auto second_plan = best.find(second);
+                if (first_plan == best.end() || second_plan == best.end()) {
+                    return;
+                }
+                // Copies: inserting into the memo may rehash it.
+                const Entry first_entry = first_plan->second;
+                const Entry second_entry = second_plan->second;
+                uint64_t joined = first | second;
+                double rows = estimate_rows(joined);
+                for (bool swapped : {false, true}) {
+                    uint64_t outer = swapped ? second : first;
+                    uint64_t inner = swapped ? first : second;
+                    const Entry &o = swapped ? second_entry : first_entry;
+                    const Entry &i = swapped ? first_entry : second_entry;
+                    Entry candidate{rows, o.cost + i.cost + hash_join_cost(o.rows, i.rows), outer, inner,
+                                    JoinAlgorithm::HASH_JOIN};
+                    if (can_probe_index(outer, inner)) {
+                        // The inner table is not scanned; it is probed through its index.
+                        const JoinRelation &relation = graph.relations[lowest(inner)];
+                        double index_cost = o.cost + index_nested_loop_join_cost(o.rows, relation.table_rows);
+                        if (index_cost < candidate.cost) {
+                            candidate.cost = index_cost;
+                            candidate.algorithm = JoinAlgorithm::INDEX_NESTED_LOOP_JOIN;
+                        }
+                    }
+                    auto current = best.find(joined);
+                    if (current == best.end() || candidate.cost < current->second.cost) {
+                        best[joined] = candidate;
+                    }
+                }
+            }
+
+            void enumerate_csg(uint64_t set, uint64_t excluded) {
+                uint64_t candidates = neighborhood(set) & ~excluded;
+                for (uint64_t subset = (0 - candidates) & candidates; subset != 0; subset = (subset - candidates) & candidates) {
+                    emit_csg(set | subset);
+                }
+                for (uint64_t subset = (0 - candidates) & candidates; subset != 0; subset = (subset - candidates) & candidates) {
+                    enumerate_csg(set | subset, excluded | candidates);
+                }
+            }
+
+            void emit_csg(uint64_t set) {
+                uint64_t excluded = set | below_or_equal(lowest(set));
+                uint64_t candidates = neighborhood(set) & ~excluded;
+                for (size_t i = graph.relations.size(); i-- > 0;) {
+                    if ((candidates & bit(i)) == 0) continue;
+                    consider(set, bit(i));
+                    enumerate_cmp(set, bit(i), excluded | (candidates & below_or_equal(i)));
+                }
+            }
+
+            void enumerate_cmp(uint64_t set, uint64_t complement, uint64_t excluded) {
+                uint64_t candidates = neighborhood(complement) & ~excluded;
+                for (uint64_t subset = (0 - candidates) & candidates; subset != 0; subset = (subset - candidates) & candidates) {
+                    consider(set, complement | subset);
+                }
+                for (uint64_t subset = (0 - candidates) & candidates; subset != 0; subset = (subset - candidates) & candidates) {
+                    enumerate_cmp(set, complement | subset, excluded | candidates);
+                }
+            }
+
+            std::unique_ptr<JoinPlan> build(uint64_t set) const {
+                const Entry &entry = best.at(set);
+                auto plan = std::make_unique<JoinPlan>();
+                plan->relations = set;
+                plan->rows = entry.rows;
+                plan->cost = entry.cost;
+                if (entry.outer == 0) {
+                    plan->relation = lowest(set);
+                    return plan;
+                }
+                plan->algorithm = entry.algorithm;
+                plan->left = build(entry.outer);
+                plan->right = build(entry.inner);
+                return plan;
+            }
+
+            const JoinGraph &graph;
+            std::vector<uint64_t> neighbors;
+            std::unordered_map<uint64_t, Entry> best;
+        };
+
+    } // namespace
+
+    std::string JoinPlan::to_string(const JoinGraph &graph) const {
+        if (is_leaf()) {
+            const JoinRelation &leaf = graph.relations[relation];
+            return leaf.alias.empty() ? leaf.table : leaf.alias;
+        }
+        return std::string(algorithm_name(algorithm)) + "(" + left->to_string(graph) + ", " + right->to_string(graph) + ")";
+    }
+
+    JoinGraph build_join_graph(const SelectStatementNode &select, const StatisticsCatalog &catalog) {
+        JoinGraph graph;
+        std::vector<std::optional<TableStatistics>> statistics;
+        std::vector<const ExpressionNode *> conjuncts;
+
+        auto add_relation = [&](const SelectStatementNode::TableReference &reference) {
+            JoinRelation relation;
+            relation.table = reference.name->name;
+            relation.alias = reference.alias;
+            std::optional<TableStatistics> table_statistics = catalog.get(relation.table);
+            if (!table_statistics) {
+                relation.table_rows = DEFAULT_TABLE_ROWS;
+            } else if (table_statistics->row_count > 0) {
+                relation.table_rows = static_cast<double>(table_statistics->row_count);
+            } else {
+                relation.table_rows = table_statistics->analyzed_row_count;
+            }
+            relation.rows = relation.table_rows;
+            graph.relations.push_back(std::move(relation));
+            statistics.push_back(std::move(table_statistics));
+        };
+
+        if (select.from_clause != nullptr) {
+            add_relation(*select.from_clause);
+        }
+        for (const auto &join : select.join_clause) {
+            add_relation(*join.table);
+            std::vector<const ExpressionNode *> on_conjuncts = split_conjuncts(join.on_condition.get());
+            conjuncts.insert(conjuncts.end(), on_conjuncts.begin(), on_conjuncts.end());
+        }
+        if (graph.relations.size() > MAX_RELATIONS) {
+            throw std::runtime_error("Cannot join more than " + std::to_string(MAX_RELATIONS) + " tables");
+        }
+        std::vector<const ExpressionNode *> where_conjuncts = split_conjuncts(select.where_clause.get());
+        conjuncts.insert(conjuncts.end(), where_conjuncts.begin(), where_conjuncts.end());
+
+        for (const ExpressionNode *conjunct : conjuncts) {
+            if (std::optional<ColumnComparison> filter = match_column_comparison(*conjunct)) {
+                std::optional<ColumnRef> column = resolve_column(filter->column, graph.relations);
+                if (column) {
+                    const std::optional<TableStatistics> &table_statistics = statistics[column->relation];
+                    const ColumnStatistics *column_statistics =
+                            table_statistics ? table_statistics->column_statistics(column->column) : nullptr;
+                    graph.relations[column->relation].rows *= comparison_selectivity(column_statistics, *filter);
+                }
+                continue;
+            }
+
+            auto *comparison = dynamic_cast<const BinaryOperationNode *>(conjunct);
+            if (comparison == nullptr || comparison->op != "=") {
+                continue;
+            }
+            std::optional<ColumnRef> left = resolve_column(comparison->left.get(), graph.relations);
+            std::optional<ColumnRef> right = resolve_column(comparison->right.get(), graph.relations);
+            if (!left || !right || left->relation == right->relation) {
+                continue;
+            }
+            JoinPredicate predicate{left->relation, right->relation, left->column, right->column};
+            const std::optional<TableStatistics> &left_statistics = statistics[left->relation];
+            const std::optional<TableStatistics> &right_statistics = statistics[right->relation];
+            predicate.selectivity = equi_join_selectivity(
+                    distinct_values(left_statistics, left->column, graph.relations[left->relation].table_rows),
+                    distinct_values(right_statistics, right->column, graph.relations[right->relation].table_rows));
+            predicate.left_indexed = left_statistics && left_statistics->bounds(left->column) != nullptr;
+            predicate.right_indexed = right_statistics && right_statistics->bounds(right->column) != nullptr;
+            graph.predicates.push_back(std::move(predicate));
+        }
+
+        for (auto &relation : graph.relations) {
+            relation.rows = std::max(relation.rows, std::min(relation.table_rows, 1.0));
+        }
+        return graph;
+    }
+
+    std::unique_ptr<JoinPlan> optimize_join_order(const JoinGraph &graph, size_t dp_table_limit) {
+        if (graph.relations.empty()) {
+            return nullptr;
+        }
+        if (graph.relations.size() > MAX_RELATIONS) {
+            throw std::runtime_error("Cannot join more than " + std::to_string(MAX_RELATIONS) + " tables");
+        }
+        JoinOptimizer optimizer(graph);
+        return graph.relations.size() <= dp_table_limit ? optimizer.dynamic_programming() : optimizer.greedy();
+    }
+
+} // namespace minidb
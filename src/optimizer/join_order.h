@@ -0,0 +1,105 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "catalog/table_statistics.h"
+#include "cost_model.h"
+#include "sql/ast.h"
+
+namespace minidb {
+
+    // Used for tables the catalog does not track.
+    static constexpr double DEFAULT_TABLE_ROWS = 1000.0;
+
+    // Queries with more tables than this are ordered greedily; exhaustive search is too slow.
+    static constexpr size_t DEFAULT_DP_TABLE_LIMIT = 10;
+
+    /**
+     * @struct JoinRelation
+     * @brief One table of a join query.
+     */
+    struct JoinRelation {
+        std::string table;
+        std::string alias; // Empty if none
+        double table_rows = 0; // Rows stored in the table
+        double rows = 0;       // Rows left after the filters that only involve this table
+        std::optional<double> scan_cost = std::nullopt; // Cost of the chosen access path; a full scan if unset
+    };
+
+    /**
+     * @struct JoinPredicate
+     * @brief An equality between columns of two relations, i.e. an edge of the join graph.
+     */
+    struct JoinPredicate {
+        size_t left;
+        size_t right;
+        std::string left_column;
+        std::string right_column;
+        double selectivity = 1.0;
+        bool left_indexed = false;  // An index on left_column can serve index nested-loop joins
+        bool right_indexed = false;
+    };
+
+    /**
+     * @struct JoinGraph
+     * @brief The tables of a query and the join predicates between them.
+     */
+    struct JoinGraph {
+        std::vector<JoinRelation> relations;
+        std::vector<JoinPredicate> predicates;
+    };
+
+    /**
+     * @struct JoinPlan
+     * @brief A join tree. Leaves scan one relation; inner nodes join the left (outer) input with
+     * the right (inner) input.
+     */
+    struct JoinPlan {
+        uint64_t relations = 0; // Bit i is set if relation i is part of this subtree
+        double rows = 0;        // Estimated output rows
+        double cost = 0;        // Estimated cost of the whole subtree
+        size_t relation = 0;    // The relation a leaf scans
+        JoinAlgorithm algorithm = JoinAlgorithm::HASH_JOIN;
+        std::unique_ptr<JoinPlan> left;
+        std::unique_ptr<JoinPlan> right;
+
+        bool is_leaf() const { return left == nullptr; }
+
+        /// @brief Renders the tree using aliases, e.g. "HASH_JOIN(INDEX_NESTED_LOOP_JOIN(o, c), p)".
+        std::string to_string(const JoinGraph &graph) const;
+    };
+
+    /**
+     * @brief Builds the join graph of a SELECT from its FROM and JOIN tables, ON conditions and WHERE clause.
+     *
+     * Every AND-ed 'a.x = b.y' between two tables becomes an edge, with a selectivity from the
+     * columns' distinct counts. Every AND-ed comparison of one table's column with a literal
+     * reduces that table's row estimate. Other conditions do not affect the estimates.
+     * Columns must be qualified by a table name or alias unless there is only one table.
+     *
+     * @throws std::runtime_error if the query joins more than 64 tables.
+     */
+    JoinGraph build_join_graph(const SelectStatementNode &select, const StatisticsCatalog &catalog);
+
+    /**
+     * @brief Finds the cheapest join order and join algorithms.
+     *
+     * Up to `dp_table_limit` relations, the search is exhaustive over bushy trees without
+     * cross products, using DPccp (Moerkotte and Neumann): it only considers pairs of connected
+     * subgraphs that are connected to each other, so it never looks at a plan with a needless
+     * cross product. Above the limit, plans are combined greedily, always performing the join
+     * with the smallest result next. Tables that no predicate connects are joined by cross product.
+     *
+     * @return The plan, or nullptr if the graph has no relations.
+     */
+    std::unique_ptr<JoinPlan> optimize_join_order(const JoinGraph &graph, size_t dp_table_limit = DEFAULT_DP_TABLE_LIMIT);
+
+} // namespace minidb
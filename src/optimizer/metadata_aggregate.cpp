@@ -0,0 +1,61 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file metadata_aggregate.cpp
+ * @brief Answers COUNT(*), MIN and MAX from the catalog or an index endpoint.
+ */
+
+#include "metadata_aggregate.h"
+#include <strings.h>
+
+namespace minidb {
+
+    std::optional<std::vector<MetadataAggregate>> plan_metadata_aggregates(const SelectStatementNode &select,
+                                                                          const StatisticsCatalog &catalog) {
+        if (select.is_select_all || select.columns.empty() || select.from_clause == nullptr
+            || select.where_clause != nullptr || !select.join_clause.empty() || select.group_by != nullptr) {
+            return std::nullopt;
+        }
+        std::optional<TableStatistics> statistics = catalog.get(select.from_clause->name->name);
+        if (!statistics) {
+            return std::nullopt;
+        }
+
+        std::vector<MetadataAggregate> plan;
+        for (const auto &column : select.columns) {
+            auto *call = dynamic_cast<const FunctionCallNode *>(column.expression.get());
+            if (call == nullptr) {
+                return std::nullopt;
+            }
+
+            if (strcasecmp(call->name.c_str(), "COUNT") == 0 && call->is_star_argument) {
+                plan.push_back({MetadataAggregate::Function::COUNT_STAR, "", AggregateSource::TABLE_METADATA,
+                                static_cast<int64_t>(statistics->row_count)});
+                continue;
+            }
+
+            bool is_min = strcasecmp(call->name.c_str(), "MIN") == 0;
+            bool is_max = strcasecmp(call->name.c_str(), "MAX") == 0;
+            if (!(is_min || is_max) || call->arguments.size() != 1) {
+                return std::nullopt;
+            }
+            auto *argument = dynamic_cast<const IdentifierNode *>(call->arguments[0].get());
+            const ColumnBounds *bounds = argument != nullptr ? statistics->bounds(argument->name) : nullptr;
+            if (bounds == nullptr) {
+                return std::nullopt; // Not an indexed column.
+            }
+
+            MetadataAggregate aggregate{is_min ? MetadataAggregate::Function::MIN : MetadataAggregate::Function::MAX,
+                                        argument->name, AggregateSource::INDEX_ENDPOINT, std::nullopt};
+            if (is_min ? bounds->min_exact : bounds->max_exact) {
+                aggregate.source = AggregateSource::TABLE_METADATA;
+                aggregate.value = is_min ? bounds->min : bounds->max;
+            }
+            plan.push_back(std::move(aggregate));
+        }
+        return plan;
+    }
+
+} // namespace minidb
@@ -0,0 +1,55 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include "catalog/table_statistics.h"
+#include "sql/ast.h"
+
+namespace minidb {
+
+    /**
+     * @enum AggregateSource
+     * @brief Where a metadata-only aggregate gets its value instead of scanning the table.
+     */
+    enum class AggregateSource {
+        TABLE_METADATA, // Committed row count or column bound in the StatisticsCatalog
+        INDEX_ENDPOINT  // First or last key of the column's index
+    };
+
+    /**
+     * @struct MetadataAggregate
+     * @brief One SELECT-list aggregate that can be answered without a table scan.
+     */
+    struct MetadataAggregate {
+        enum class Function {
+            COUNT_STAR,
+            MIN,
+            MAX
+        };
+
+        Function function;
+        std::string column; // Empty for COUNT(*)
+        AggregateSource source;
+        // The answer when source is TABLE_METADATA. nullopt means NULL (MIN/MAX of an empty table).
+        std::optional<LiteralValue> value;
+    };
+
+    /**
+     * @brief Checks whether a SELECT can be answered from table metadata and, if so, how.
+     *
+     * Applies to 'SELECT COUNT(*), MIN(c), MAX(c) FROM t' with any mix of those
+     * aggregates, where every MIN/MAX column is indexed, and there is no WHERE, JOIN or
+     * GROUP BY. COUNT(*) always comes from the row count. MIN/MAX come from the catalog
+     * while the bound is exact, and from the index endpoint otherwise.
+     *
+     * @return The plan for each SELECT-list entry in order, or nullopt if the table must be scanned.
+     */
+    std::optional<std::vector<MetadataAggregate>> plan_metadata_aggregates(const SelectStatementNode &select,
+                                                                          const StatisticsCatalog &catalog);
+
+} // namespace minidb
@@ -0,0 +1,165 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file plan_cache.cpp
+ * @brief Prepared statements and the LRU plan cache, revalidated against catalog plan versions.
+ */
+
+#include "plan_cache.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include "sql/fingerprint.h"
+#include "sql/lexer.h"
+#include "sql/parser.h"
+
+namespace minidb {
+
+    namespace {
+
+        std::string normalize(const std::string &name) {
+            std::string lowered(name);
+            std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lowered;
+        }
+
+        std::vector<std::string> statement_tables(const ASTNode &statement) {
+            if (auto *select = dynamic_cast<const SelectStatementNode *>(&statement)) {
+                return referenced_tables(*select);
+            }
+            if (auto *insert = dynamic_cast<const InsertStatementNode *>(&statement)) {
+                return {normalize(insert->tableName->name)};
+            }
+            if (auto *update = dynamic_cast<const UpdateStatementNode *>(&statement)) {
+                return {normalize(update->table_name->name)};
+            }
+            if (auto *remove = dynamic_cast<const DeleteStatementNode *>(&statement)) {
+                return {normalize(remove->table_name->name)};
+            }
+            throw std::runtime_error("Only SELECT, INSERT, UPDATE and DELETE can be prepared");
+        }
+
+    } // namespace
+
+    PreparedStatement prepare_statement(std::shared_ptr<const ASTNode> statement, size_t parameter_count,
+                                        const StatisticsCatalog &catalog, const IndexCatalog &indexes) {
+        PreparedStatement prepared;
+        // Versions are read before planning: a change made while planning leaves the plan stale.
+        for (auto &table : statement_tables(*statement)) {
+            uint64_t version = catalog.plan_version(table);
+            prepared.table_versions.emplace_back(std::move(table), version);
+        }
+        auto *select = dynamic_cast<const SelectStatementNode *>(statement.get());
+        if (select != nullptr && select->from_clause != nullptr) {
+            prepared.plan = explain_select(*select, catalog, indexes);
+        }
+        prepared.statement = std::move(statement);
+        prepared.parameter_count = parameter_count;
+        return prepared;
+    }
+
+    bool PlanCache::is_current(const PreparedStatement &prepared) const {
+        return std::all_of(prepared.table_versions.begin(), prepared.table_versions.end(), [this](const auto &table) {
+            return catalog.plan_version(table.first) == table.second;
+        });
+    }
+
+    std::shared_ptr<const PreparedStatement> PlanCache::replan(const PreparedStatement &stale) const {
+        return std::make_shared<const PreparedStatement>(
+                prepare_statement(stale.statement, stale.parameter_count, catalog, indexes));
+    }
+
+    std::shared_ptr<const PreparedStatement> PlanCache::get(const std::string &text) {
+        std::shared_ptr<const PreparedStatement> cached;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            auto it = entries.find(text);
+            if (it != entries.end()) {
+                lru.splice(lru.begin(), lru, it->second);
+                cached = it->second->prepared;
+            }
+        }
+        // Planning happens outside the lock so other sessions keep hitting the cache meanwhile.
+        if (cached && is_current(*cached)) {
+            std::lock_guard<std::mutex> guard(lock);
+            counters.hits++;
+            return cached;
+        }
+
+        std::shared_ptr<const PreparedStatement> prepared;
+        if (cached) {
+            prepared = replan(*cached);
+        } else {
+            Lexer lexer(text);
+            Parser parser(lexer.tokenize());
+            std::shared_ptr<const ASTNode> statement = parser.parse();
+            prepared = std::make_shared<const PreparedStatement>(
+                    prepare_statement(std::move(statement), parser.parameter_count(), catalog, indexes));
+        }
+
+        std::lock_guard<std::mutex> guard(lock);
+        (cached ? counters.replans : counters.misses)++;
+        auto it = entries.find(text);
+        if (it != entries.end()) {
+            it->second->prepared = prepared;
+            lru.splice(lru.begin(), lru, it->second);
+            return prepared;
+        }
+        while (entries.size() >= capacity) {
+            entries.erase(lru.back().text);
+            lru.pop_back();
+            counters.evictions++;
+        }
+        lru.push_front(Entry{text, prepared});
+        entries[text] = lru.begin();
+        counters.entries = entries.size();
+        return prepared;
+    }
+
+    void PlanCache::prepare(PrepareStatementNode &prepare) {
+        std::shared_ptr<const ASTNode> statement = std::move(prepare.statement);
+        auto prepared = std::make_shared<const PreparedStatement>(
+                prepare_statement(std::move(statement), prepare.parameter_count, catalog, indexes));
+        std::lock_guard<std::mutex> guard(lock);
+        named_statements[normalize(prepare.name->name)] = std::move(prepared);
+    }
+
+    std::shared_ptr<const PreparedStatement> PlanCache::named(const std::string &name) {
+        std::string key = normalize(name);
+        std::shared_ptr<const PreparedStatement> prepared;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            auto it = named_statements.find(key);
+            if (it == named_statements.end()) {
+                throw std::runtime_error("Prepared statement " + name + " does not exist");
+            }
+            prepared = it->second;
+        }
+        if (is_current(*prepared)) {
+            return prepared;
+        }
+
+        std::shared_ptr<const PreparedStatement> fresh = replan(*prepared);
+        std::lock_guard<std::mutex> guard(lock);
+        counters.replans++;
+        auto it = named_statements.find(key);
+        if (it != named_statements.end() && it->second == prepared) {
+            it->second = fresh;
+        }
+        return fresh;
+    }
+
+    void PlanCache::deallocate(const std::string &name) {
+        std::lock_guard<std::mutex> guard(lock);
+        named_statements.erase(normalize(name));
+    }
+
+    PlanCacheStats PlanCache::stats() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return counters;
+    }
+
+} // namespace minidb
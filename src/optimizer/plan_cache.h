@@ -0,0 +1,125 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "access_path.h"
+#include "catalog/table_statistics.h"
+#include "explain.h"
+#include "sql/ast.h"
+
+namespace minidb {
+
+    /**
+     * @struct PreparedStatement
+     * @brief A parsed statement with its generic plan, ready to execute with any parameter values.
+     */
+    struct PreparedStatement {
+        std::shared_ptr<const ASTNode> statement; // SELECT, INSERT, UPDATE or DELETE
+        size_t parameter_count = 0;
+        // SELECT only: planned without parameter values, using parameter_selectivity().
+        std::shared_ptr<const ExplainNode> plan;
+        // Catalog plan versions of the tables the statement touches, when it was planned.
+        std::vector<std::pair<std::string, uint64_t>> table_versions;
+    };
+
+    /**
+     * @brief Plans a parsed statement against the current catalog.
+     * @throws std::runtime_error if the statement is not a SELECT, INSERT, UPDATE or DELETE.
+     */
+    PreparedStatement prepare_statement(std::shared_ptr<const ASTNode> statement, size_t parameter_count,
+                                        const StatisticsCatalog &catalog, const IndexCatalog &indexes);
+
+    /**
+     * @struct PlanCacheStats
+     * @brief Counters reported by PlanCache::stats().
+     */
+    struct PlanCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;    // Statement text lexed, parsed and planned
+        uint64_t replans = 0;   // Plans rebuilt because a table's schema or statistics changed
+        uint64_t evictions = 0; // Entries dropped to stay under the capacity
+        size_t entries = 0;
+    };
+
+    /**
+     * @class PlanCache
+     * @brief Bounded LRU cache of prepared statements keyed by statement text, plus the
+     * statements prepared by name with PREPARE.
+     *
+     * get() skips lexing, parsing and planning for text it has seen before. A cached plan
+     * records the StatisticsCatalog::plan_version() of every table it touches and is
+     * rebuilt from the cached AST when one of them moved: after DDL, ANALYZE, or an explicit
+     * invalidate_plans(). All methods are thread-safe.
+     *
+     * @par Usage Example:
+     * @code
+     * PlanCache cache(catalog, indexes);
+     * auto prepared = cache.get("SELECT name FROM users WHERE id = ?");
+     * execute(*prepared, ParameterValues{int64_t{42}});
+     * @endcode
+     */
+    class PlanCache {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 256;
+
+        /**
+         * @param indexes Indexes available to the planner. Call catalog.invalidate_plans()
+         *                after changing the indexes of a table.
+         * @param capacity Statements cached by text. Named statements do not count.
+         */
+        PlanCache(const StatisticsCatalog &catalog, const IndexCatalog &indexes, size_t capacity = DEFAULT_CAPACITY)
+                : catalog(catalog), indexes(indexes), capacity(capacity == 0 ? 1 : capacity) {}
+
+        /**
+         * @brief The prepared form of a statement, from the cache or freshly planned.
+         * @throws std::runtime_error if the text does not parse or cannot be prepared.
+         */
+        std::shared_ptr<const PreparedStatement> get(const std::string &text);
+
+        /// @brief Stores a PREPARE statement under its name, replacing any statement of that name.
+        void prepare(PrepareStatementNode &prepare);
+
+        /**
+         * @brief The statement prepared under a name, re-planned if it is stale.
+         * @throws std::runtime_error if no statement has that name.
+         */
+        std::shared_ptr<const PreparedStatement> named(const std::string &name);
+
+        /// @brief Forgets a named statement. Unknown names are ignored.
+        void deallocate(const std::string &name);
+
+        PlanCacheStats stats() const;
+
+    private:
+        struct Entry {
+            std::string text;
+            std::shared_ptr<const PreparedStatement> prepared;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        bool is_current(const PreparedStatement &prepared) const;
+        std::shared_ptr<const PreparedStatement> replan(const PreparedStatement &stale) const;
+
+        const StatisticsCatalog &catalog;
+        const IndexCatalog &indexes;
+        const size_t capacity;
+        mutable std::mutex lock;
+        EntryList lru; // Most recently used first
+        std::unordered_map<std::string, EntryList::iterator> entries;
+        std::unordered_map<std::string, std::shared_ptr<const PreparedStatement>> named_statements;
+        PlanCacheStats counters;
+    };
+
+} // namespace minidb
@@ -0,0 +1,106 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file selectivity.cpp
+ * @brief Predicate selectivity estimation.
+ */
+
+#include "selectivity.h"
+#include <algorithm>
+
+namespace minidb {
+
+    double comparison_selectivity(const ColumnStatistics *statistics, const std::string &op, const LiteralValue &value) {
+        bool is_equal = op == "=";
+        bool is_not_equal = op == "!=" || op == "<>";
+        if (statistics == nullptr) {
+            if (is_equal) return DEFAULT_EQUALITY_SELECTIVITY;
+            if (is_not_equal) return 1.0 - DEFAULT_EQUALITY_SELECTIVITY;
+            return DEFAULT_RANGE_SELECTIVITY;
+        }
+
+        double non_null = 1.0 - statistics->null_fraction;
+        double equal = statistics->equal_selectivity(value);
+        double selectivity;
+        if (is_equal) {
+            selectivity = equal;
+        } else if (is_not_equal) {
+            selectivity = non_null - equal;
+        } else if (op == "<") {
+            selectivity = statistics->less_than_selectivity(value);
+        } else if (op == "<=") {
+            selectivity = statistics->less_than_selectivity(value) + equal;
+        } else if (op == ">") {
+            selectivity = non_null - statistics->less_than_selectivity(value) - equal;
+        } else if (op == ">=") {
+            selectivity = non_null - statistics->less_than_selectivity(value);
+        } else {
+            selectivity = DEFAULT_RANGE_SELECTIVITY;
+        }
+        return std::clamp(selectivity, 0.0, 1.0);
+    }
+
+    double parameter_selectivity(const ColumnStatistics *statistics, const std::string &op) {
+        bool is_equal = op == "=";
+        bool is_not_equal = op == "!=" || op == "<>";
+        if (statistics == nullptr || (!is_equal && !is_not_equal)) {
+            return comparison_selectivity(nullptr, op, LiteralValue{});
+        }
+        double non_null = 1.0 - statistics->null_fraction;
+        double equal = non_null / std::max(statistics->distinct_count, 1.0);
+        return std::clamp(is_equal ? equal : non_null - equal, 0.0, 1.0);
+    }
+
+    double comparison_selectivity(const ColumnStatistics *statistics, const ColumnComparison &comparison) {
+        return comparison.parameter ? parameter_selectivity(statistics, comparison.op)
+                                    : comparison_selectivity(statistics, comparison.op, comparison.value);
+    }
+
+    double equi_join_selectivity(double left_distinct, double right_distinct) {
+        return 1.0 / std::max({left_distinct, right_distinct, 1.0});
+    }
+
+    std::string commute_comparison(const std::string &op) {
+        if (op == "<") return ">";
+        if (op == "<=") return ">=";
+        if (op == ">") return "<";
+        if (op == ">=") return "<=";
+        return op;
+    }
+
+    std::optional<ColumnComparison> match_column_comparison(const ExpressionNode &expression) {
+        auto *binary = dynamic_cast<const BinaryOperationNode *>(&expression);
+        if (binary == nullptr) {
+            return std::nullopt;
+        }
+        const std::string &op = binary->op;
+        if (op != "=" && op != "!=" && op != "<>" && op != "<" && op != "<=" && op != ">" && op != ">=") {
+            return std::nullopt;
+        }
+        auto is_column = [](const ExpressionNode *node) {
+            return dynamic_cast<const IdentifierNode *>(node) != nullptr
+                   || dynamic_cast<const QualifiedIdentifierNode *>(node) != nullptr;
+        };
+        auto operand = [](const ExpressionNode *node) -> std::optional<ColumnComparison> {
+            if (auto *literal = dynamic_cast<const LiteralNode *>(node)) {
+                return ColumnComparison{nullptr, "", literal->value, std::nullopt};
+            }
+            if (auto *parameter = dynamic_cast<const ParameterNode *>(node)) {
+                return ColumnComparison{nullptr, "", LiteralValue{}, parameter->index};
+            }
+            return std::nullopt;
+        };
+        std::optional<ColumnComparison> comparison;
+        if (is_column(binary->left.get()) && (comparison = operand(binary->right.get()))) {
+            comparison->column = binary->left.get();
+            comparison->op = op;
+        } else if (is_column(binary->right.get()) && (comparison = operand(binary->left.get()))) {
+            comparison->column = binary->right.get();
+            comparison->op = commute_comparison(op);
+        }
+        return comparison;
+    }
+
+} // namespace minidb
@@ -0,0 +1,70 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include "catalog/column_statistics.h"
+#include "sql/ast.h"
+
+/**
+ * @file selectivity.h
+ * @brief Fraction of rows that pass a predicate, from ANALYZE statistics or fixed defaults.
+ */
+
+namespace minidb {
+
+    // Used when the column has not been analyzed.
+    static constexpr double DEFAULT_EQUALITY_SELECTIVITY = 0.005;
+    static constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3.0;
+
+    /**
+     * @brief Selectivity of 'column op value'.
+     * @param statistics The column's statistics, or nullptr if it was never analyzed.
+     * @param op One of =, !=, <>, <, <=, >, >=. Any other operator gets the range default.
+     */
+    double comparison_selectivity(const ColumnStatistics *statistics, const std::string &op, const LiteralValue &value);
+
+    /**
+     * @brief Selectivity of 'column op $n' for a value not known until execution.
+     *
+     * Used for the generic plan of a prepared statement: '=' assumes a value drawn evenly
+     * from the column's distinct values, ranges get the default.
+     */
+    double parameter_selectivity(const ColumnStatistics *statistics, const std::string &op);
+
+    /**
+     * @brief Selectivity of 'left.column = right.column', given each column's distinct count.
+     */
+    double equi_join_selectivity(double left_distinct, double right_distinct);
+
+    /**
+     * @brief The operator to use when the operands of a comparison are swapped ('5 < x' is 'x > 5').
+     */
+    std::string commute_comparison(const std::string &op);
+
+    /**
+     * @struct ColumnComparison
+     * @brief A comparison of a column with a literal or a parameter, with the column on the left.
+     */
+    struct ColumnComparison {
+        const ExpressionNode *column; // An IdentifierNode or QualifiedIdentifierNode
+        std::string op;
+        LiteralValue value;
+        std::optional<size_t> parameter; // Set for 'column op $n'; `value` is then unused
+    };
+
+    /**
+     * @brief Recognizes 'column op literal' and 'literal op column', where op is a comparison,
+     * and the same with a parameter in place of the literal.
+     */
+    std::optional<ColumnComparison> match_column_comparison(const ExpressionNode &expression);
+
+    /**
+     * @brief Selectivity of a matched comparison, whether its operand is a literal or a parameter.
+     */
+    double comparison_selectivity(const ColumnStatistics *statistics, const ColumnComparison &comparison);
+
+} // namespace minidb
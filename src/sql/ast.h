@@ -8,17 +8,12 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include "literal_value.h"
+#include "token.h"
+#include "value_block.h"
 
 namespace minidb {
 
-    struct SQLDate {
-        int year, month, day;
-    };
-
-    struct SQLTimestamp {
-        int year, month, day, hour, minute, second;
-    };
-
 /**
  * @class ASTNode
  * @brief The base class for all nodes in the Abstract Syntax Tree.
@@ -69,8 +64,19 @@ namespace minidb {
         template<typename T>
         explicit LiteralNode(T val) : value(std::move(val)) {}
 
-        std::variant<int64_t, double, std::string, bool, SQLDate, SQLTimestamp> value;
+        LiteralValue value;
+
+    };
+
+/**
+ * @class ParameterNode
+ * @brief Represents a parameter placeholder of a prepared statement, '?' or '$n'.
+ */
+    class ParameterNode : public ExpressionNode {
+    public:
+        size_t index; // 1-based: '$1' or the first '?'
 
+        explicit ParameterNode(size_t index) : index(index) {}
     };
 
 /**
@@ -111,6 +117,19 @@ namespace minidb {
                 : qualifier(std::move(qualifier)), name(std::move(name)) {}
     };
 
+/**
+ * @class FunctionCallNode
+ * @brief Represents a function or aggregate call, such as 'COUNT(*)' or 'MAX(price)'.
+ */
+    class FunctionCallNode : public ExpressionNode {
+    public:
+        std::string name; // As written; compare case-insensitively
+        std::vector<std::unique_ptr<ExpressionNode>> arguments;
+        bool is_star_argument = false; // True for COUNT(*)
+
+        explicit FunctionCallNode(std::string name) : name(std::move(name)) {}
+    };
+
     /**
      * @class SelectStatementNode
      * @brief Represents a full SELECT statement. This is a top-level AST node.
@@ -179,8 +198,16 @@ namespace minidb {
 		// This is optional
 		std::vector<std::unique_ptr<IdentifierNode>> columnNames;
 
-		// Keep list -> list [values]
-		std::vector<std::vector<std::unique_ptr<LiteralNode>>> values;
+		// The VALUES rows, stored by column
+		ValueBlock values;
+
+		// A placeholder leaves its slot in `values` unset and is listed here instead.
+		struct Parameter {
+		  size_t row;
+		  size_t column;
+		  size_t index; // 1-based parameter number
+		};
+		std::vector<Parameter> parameters;
 	};
 
     /**
@@ -243,6 +270,66 @@ namespace minidb {
         std::vector<std::unique_ptr<IdentifierNode>> columns;
     };
 
+    /**
+     * @class CreateMaterializedViewStatementNode
+     * @brief Represents a CREATE MATERIALIZED VIEW name AS SELECT ... statement.
+     */
+    class CreateMaterializedViewStatementNode final : public ASTNode {
+    public:
+        std::unique_ptr<IdentifierNode> view_name;
+        std::unique_ptr<SelectStatementNode> query;
+    };
+
+    /**
+     * @class AnalyzeStatementNode
+     * @brief Represents an ANALYZE [table_name [(column, ...)]] statement.
+     */
+    class AnalyzeStatementNode final : public ASTNode {
+    public:
+        std::unique_ptr<IdentifierNode> table_name; // nullptr analyzes every table
+        std::vector<std::unique_ptr<IdentifierNode>> columns; // empty analyzes every column
+    };
+
+    /**
+     * @class ExplainStatementNode
+     * @brief Represents EXPLAIN [ANALYZE] statement.
+     */
+    class ExplainStatementNode final : public ASTNode {
+    public:
+        bool analyze = false; // Run the statement and report what each operator actually did
+        std::unique_ptr<ASTNode> statement;
+    };
+
+    /**
+     * @class PrepareStatementNode
+     * @brief Represents PREPARE name AS statement.
+     */
+    class PrepareStatementNode final : public ASTNode {
+    public:
+        std::unique_ptr<IdentifierNode> name;
+        std::unique_ptr<ASTNode> statement; // SELECT, INSERT, UPDATE or DELETE
+        size_t parameter_count = 0;
+    };
+
+    /**
+     * @class ExecuteStatementNode
+     * @brief Represents EXECUTE name [(value, ...)].
+     */
+    class ExecuteStatementNode final : public ASTNode {
+    public:
+        std::unique_ptr<IdentifierNode> name;
+        std::vector<std::unique_ptr<LiteralNode>> arguments; // $1, $2, ... in order
+    };
+
+    /**
+     * @class DeallocateStatementNode
+     * @brief Represents DEALLOCATE name.
+     */
+    class DeallocateStatementNode final : public ASTNode {
+    public:
+        std::unique_ptr<IdentifierNode> name;
+    };
+
 
 
 } // namespace minidb
\ No newline at end of file
@@ -0,0 +1,452 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file expression_rewriter.cpp
+ * @brief Constant folding, identity simplification and duplicate removal over expression trees.
+ */
+
+#include "expression_rewriter.h"
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <strings.h>
+#include <unordered_map>
+
+namespace minidb {
+
+    namespace {
+
+        bool op_is(const std::string &op, const char *name) {
+            return strcasecmp(op.c_str(), name) == 0;
+        }
+
+        LiteralNode *as_literal(ExpressionNode *expression) {
+            return dynamic_cast<LiteralNode *>(expression);
+        }
+
+        std::optional<bool> as_bool(const LiteralNode *literal) {
+            if (literal != nullptr && std::holds_alternative<bool>(literal->value)) {
+                return std::get<bool>(literal->value);
+            }
+            return std::nullopt;
+        }
+
+        bool is_zero(const LiteralNode *literal) {
+            if (literal == nullptr) return false;
+            if (auto *i = std::get_if<int64_t>(&literal->value)) return *i == 0;
+            if (auto *d = std::get_if<double>(&literal->value)) return *d == 0.0;
+            return false;
+        }
+
+        // Result type of '+' or '-' over operands of these types, if it is numeric.
+        std::optional<ValueType> arithmetic_type(std::optional<ValueType> l, std::optional<ValueType> r) {
+            auto numeric = [](std::optional<ValueType> t) { return t == ValueType::INT || t == ValueType::FLOAT; };
+            if (!numeric(l) || !numeric(r)) return std::nullopt;
+            return l == ValueType::INT && r == ValueType::INT ? ValueType::INT : ValueType::FLOAT;
+        }
+
+        bool is_numeric(const LiteralValue &value) {
+            return std::holds_alternative<int64_t>(value) || std::holds_alternative<double>(value);
+        }
+
+        double to_double(const LiteralValue &value) {
+            if (auto *i = std::get_if<int64_t>(&value)) return static_cast<double>(*i);
+            return std::get<double>(value);
+        }
+
+        /**
+         * @brief Evaluates 'l op r' for two literals. Returns nullopt if the operation cannot be folded.
+         */
+        std::optional<LiteralValue> fold_literals(const std::string &op, const LiteralValue &l, const LiteralValue &r) {
+            if (op == "+" || op == "-") {
+                if (!is_numeric(l) || !is_numeric(r)) return std::nullopt;
+                if (std::holds_alternative<int64_t>(l) && std::holds_alternative<int64_t>(r)) {
+                    int64_t result;
+                    bool overflow = op == "+"
+                                    ? __builtin_add_overflow(std::get<int64_t>(l), std::get<int64_t>(r), &result)
+                                    : __builtin_sub_overflow(std::get<int64_t>(l), std::get<int64_t>(r), &result);
+                    if (overflow) return std::nullopt;  // Leave it for the executor to report.
+                    return result;
+                }
+                return op == "+" ? to_double(l) + to_double(r) : to_double(l) - to_double(r);
+            }
+
+            if (op_is(op, "AND") || op_is(op, "OR")) {
+                if (!std::holds_alternative<bool>(l) || !std::holds_alternative<bool>(r)) return std::nullopt;
+                return op_is(op, "AND") ? (std::get<bool>(l) && std::get<bool>(r))
+                                        : (std::get<bool>(l) || std::get<bool>(r));
+            }
+
+            auto cmp = compare_literals(l, r);
+            if (!cmp) return std::nullopt;
+            if (op == "=") return *cmp == 0;
+            if (op == "!=") return *cmp != 0;
+            if (op == "<") return *cmp < 0;
+            if (op == "<=") return *cmp <= 0;
+            if (op == ">") return *cmp > 0;
+            if (op == ">=") return *cmp >= 0;
+            return std::nullopt;
+        }
+
+        bool literals_equal(const LiteralValue &a, const LiteralValue &b) {
+            if (a.index() != b.index()) return false;
+            auto cmp = compare_literals(a, b);
+            return cmp && *cmp == 0;
+        }
+
+        size_t combine(size_t seed, size_t value) {
+            return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+        }
+
+        size_t literal_hash(const LiteralValue &value) {
+            size_t seed = value.index();
+            if (auto *i = std::get_if<int64_t>(&value)) return combine(seed, std::hash<int64_t>()(*i));
+            if (auto *d = std::get_if<double>(&value)) return combine(seed, std::hash<double>()(*d));
+            if (auto *s = std::get_if<std::string>(&value)) return combine(seed, std::hash<std::string>()(*s));
+            if (auto *b = std::get_if<bool>(&value)) return combine(seed, *b);
+            if (auto *d = std::get_if<SQLDate>(&value)) {
+                return combine(seed, (d->year * 13 + d->month) * 32 + d->day);
+            }
+            const auto &ts = std::get<SQLTimestamp>(value);
+            return combine(seed, ((((ts.year * 13 + ts.month) * 32 + ts.day) * 24 + ts.hour) * 60 + ts.minute) * 60 + ts.second);
+        }
+
+        size_t upper_hash(const std::string &text) {
+            size_t seed = text.size();
+            for (char c : text) seed = combine(seed, static_cast<size_t>(std::toupper(static_cast<unsigned char>(c))));
+            return seed;
+        }
+
+        /**
+         * @brief Collects the operands of a chain of the same associative operator, e.g. a AND (b AND c).
+         */
+        void flatten(std::unique_ptr<ExpressionNode> expression, const char *op,
+                     std::vector<std::unique_ptr<ExpressionNode>> &terms) {
+            auto *binary = dynamic_cast<BinaryOperationNode *>(expression.get());
+            if (binary != nullptr && op_is(binary->op, op)) {
+                flatten(std::move(binary->left), op, terms);
+                flatten(std::move(binary->right), op, terms);
+                return;
+            }
+            terms.push_back(std::move(expression));
+        }
+
+        void collect_terms(const ExpressionNode *expression, const char *op, std::vector<const ExpressionNode *> &terms) {
+            auto *binary = dynamic_cast<const BinaryOperationNode *>(expression);
+            if (binary != nullptr && op_is(binary->op, op)) {
+                collect_terms(binary->left.get(), op, terms);
+                collect_terms(binary->right.get(), op, terms);
+                return;
+            }
+            terms.push_back(expression);
+        }
+
+    } // namespace
+
+    bool expressions_equal(const ExpressionNode &a, const ExpressionNode &b) {
+        if (auto *la = dynamic_cast<const LiteralNode *>(&a)) {
+            auto *lb = dynamic_cast<const LiteralNode *>(&b);
+            return lb != nullptr && literals_equal(la->value, lb->value);
+        }
+        if (auto *qa = dynamic_cast<const QualifiedIdentifierNode *>(&a)) {
+            auto *qb = dynamic_cast<const QualifiedIdentifierNode *>(&b);
+            return qb != nullptr && qa->qualifier->name == qb->qualifier->name && qa->name->name == qb->name->name;
+        }
+        if (auto *ia = dynamic_cast<const IdentifierNode *>(&a)) {
+            auto *ib = dynamic_cast<const IdentifierNode *>(&b);
+            return ib != nullptr && ia->name == ib->name;
+        }
+        if (auto *fa = dynamic_cast<const FunctionCallNode *>(&a)) {
+            auto *fb = dynamic_cast<const FunctionCallNode *>(&b);
+            if (fb == nullptr || strcasecmp(fa->name.c_str(), fb->name.c_str()) != 0
+                || fa->is_star_argument != fb->is_star_argument || fa->arguments.size() != fb->arguments.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < fa->arguments.size(); i++) {
+                if (!expressions_equal(*fa->arguments[i], *fb->arguments[i])) return false;
+            }
+            return true;
+        }
+        if (auto *ba = dynamic_cast<const BinaryOperationNode *>(&a)) {
+            auto *bb = dynamic_cast<const BinaryOperationNode *>(&b);
+            return bb != nullptr && strcasecmp(ba->op.c_str(), bb->op.c_str()) == 0
+                   && expressions_equal(*ba->left, *bb->left) && expressions_equal(*ba->right, *bb->right);
+        }
+        return false;
+    }
+
+    size_t expression_hash(const ExpressionNode &expression) {
+        if (auto *literal = dynamic_cast<const LiteralNode *>(&expression)) {
+            return combine(1, literal_hash(literal->value));
+        }
+        if (auto *qualified = dynamic_cast<const QualifiedIdentifierNode *>(&expression)) {
+            return combine(combine(2, std::hash<std::string>()(qualified->qualifier->name)),
+                           std::hash<std::string>()(qualified->name->name));
+        }
+        if (auto *identifier = dynamic_cast<const IdentifierNode *>(&expression)) {
+            return combine(3, std::hash<std::string>()(identifier->name));
+        }
+        if (auto *call = dynamic_cast<const FunctionCallNode *>(&expression)) {
+            size_t seed = combine(combine(5, upper_hash(call->name)), call->is_star_argument);
+            for (const auto &argument : call->arguments) seed = combine(seed, expression_hash(*argument));
+            return seed;
+        }
+        if (auto *binary = dynamic_cast<const BinaryOperationNode *>(&expression)) {
+            size_t seed = combine(4, upper_hash(binary->op));
+            return combine(combine(seed, expression_hash(*binary->left)), expression_hash(*binary->right));
+        }
+        return 0;
+    }
+
+    std::vector<const ExpressionNode *> find_common_subexpressions(const ExpressionNode &expression) {
+        // Equivalence classes of compound subexpressions: representative and occurrence count.
+        std::vector<std::pair<const ExpressionNode *, size_t>> classes;
+        std::unordered_multimap<size_t, size_t> by_hash;
+        std::unordered_map<const ExpressionNode *, size_t> class_of;
+
+        std::function<void(const ExpressionNode &)> count = [&](const ExpressionNode &node) {
+            auto *binary = dynamic_cast<const BinaryOperationNode *>(&node);
+            if (binary == nullptr) return;
+            count(*binary->left);
+            count(*binary->right);
+
+            size_t hash = expression_hash(node);
+            auto range = by_hash.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (expressions_equal(*classes[it->second].first, node)) {
+                    classes[it->second].second++;
+                    class_of[&node] = it->second;
+                    return;
+                }
+            }
+            by_hash.emplace(hash, classes.size());
+            class_of[&node] = classes.size();
+            classes.emplace_back(&node, 1);
+        };
+        count(expression);
+
+        std::vector<const ExpressionNode *> common;
+        std::vector<bool> reported(classes.size(), false);
+        std::function<void(const ExpressionNode &)> report = [&](const ExpressionNode &node) {
+            auto *binary = dynamic_cast<const BinaryOperationNode *>(&node);
+            if (binary == nullptr) return;
+            size_t id = class_of[&node];
+            if (classes[id].second > 1) {
+                if (!reported[id]) {
+                    reported[id] = true;
+                    common.push_back(classes[id].first);
+                }
+                return;  // Children are computed as part of this subexpression.
+            }
+            report(*binary->left);
+            report(*binary->right);
+        };
+        report(expression);
+        return common;
+    }
+
+    std::vector<const ExpressionNode *> split_conjuncts(const ExpressionNode *expression) {
+        std::vector<const ExpressionNode *> conjuncts;
+        std::function<void(const ExpressionNode *)> split = [&](const ExpressionNode *node) {
+            if (node == nullptr) return;
+            auto *binary = dynamic_cast<const BinaryOperationNode *>(node);
+            if (binary != nullptr && op_is(binary->op, "AND")) {
+                split(binary->left.get());
+                split(binary->right.get());
+                return;
+            }
+            conjuncts.push_back(node);
+        };
+        split(expression);
+        return conjuncts;
+    }
+
+    std::string expression_to_string(const ExpressionNode &expression) {
+        if (auto *literal = dynamic_cast<const LiteralNode *>(&expression)) {
+            return literal_to_string(literal->value);
+        }
+        if (auto *parameter = dynamic_cast<const ParameterNode *>(&expression)) {
+            return "$" + std::to_string(parameter->index);
+        }
+        if (auto *qualified = dynamic_cast<const QualifiedIdentifierNode *>(&expression)) {
+            return qualified->qualifier->name + "." + qualified->name->name;
+        }
+        if (auto *identifier = dynamic_cast<const IdentifierNode *>(&expression)) {
+            return identifier->name;
+        }
+        if (auto *call = dynamic_cast<const FunctionCallNode *>(&expression)) {
+            std::string text = call->name + "(";
+            if (call->is_star_argument) text += "*";
+            for (size_t i = 0; i < call->arguments.size(); i++) {
+                if (i > 0) text += ", ";
+                text += expression_to_string(*call->arguments[i]);
+            }
+            return text + ")";
+        }
+        if (auto *binary = dynamic_cast<const BinaryOperationNode *>(&expression)) {
+            return "(" + expression_to_string(*binary->left) + " " + binary->op + " " + expression_to_string(*binary->right) + ")";
+        }
+        return "?";
+    }
+
+    std::optional<ValueType> ExpressionRewriter::static_type(const ExpressionNode &expression) const {
+        if (auto *literal = dynamic_cast<const LiteralNode *>(&expression)) {
+            return value_type(literal->value);
+        }
+        if (dynamic_cast<const IdentifierNode *>(&expression) != nullptr
+            || dynamic_cast<const QualifiedIdentifierNode *>(&expression) != nullptr) {
+            return column_type ? column_type(expression) : std::nullopt;
+        }
+        if (auto *binary = dynamic_cast<const BinaryOperationNode *>(&expression)) {
+            if (binary->op == "+" || binary->op == "-") {
+                return arithmetic_type(static_type(*binary->left), static_type(*binary->right));
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::unique_ptr<ExpressionNode> ExpressionRewriter::rewrite(std::unique_ptr<ExpressionNode> expression) {
+        if (auto *call = dynamic_cast<FunctionCallNode *>(expression.get())) {
+            for (auto &argument : call->arguments) {
+                argument = rewrite(std::move(argument));
+            }
+            return expression;
+        }
+        if (dynamic_cast<BinaryOperationNode *>(expression.get()) == nullptr) {
+            return expression;
+        }
+        std::unique_ptr<BinaryOperationNode> binary(static_cast<BinaryOperationNode *>(expression.release()));
+        return rewrite_binary(std::move(binary));
+    }
+
+    std::unique_ptr<ExpressionNode> ExpressionRewriter::rewrite_binary(std::unique_ptr<BinaryOperationNode> node) {
+        node->left = rewrite(std::move(node->left));
+        node->right = rewrite(std::move(node->right));
+
+        LiteralNode *left = as_literal(node->left.get());
+        LiteralNode *right = as_literal(node->right.get());
+
+        if (left != nullptr && right != nullptr) {
+            if (auto folded = fold_literals(node->op, left->value, right->value)) {
+                rewrites++;
+                return std::make_unique<LiteralNode>(std::move(*folded));
+            }
+            return node;
+        }
+
+        if (node->op == "+" || node->op == "-") {
+            // Dropping the zero must keep the operand's type: 'int_col + 0.0' is a double and
+            // 'name + 0' is a type error, not 'name'.
+            auto keeps_type = [this](const ExpressionNode &operand, const LiteralNode &zero) {
+                std::optional<ValueType> type = static_type(operand);
+                return type && arithmetic_type(type, value_type(zero.value)) == type;
+            };
+            if (is_zero(right) && keeps_type(*node->left, *right)) {
+                rewrites++;
+                return std::move(node->left);
+            }
+            if (node->op == "+" && is_zero(left) && keeps_type(*node->right, *left)) {
+                rewrites++;
+                return std::move(node->right);
+            }
+            return node;
+        }
+
+        bool is_and = op_is(node->op, "AND");
+        if (is_and || op_is(node->op, "OR")) {
+            // AND: TRUE is the identity and FALSE absorbs. OR: the other way around.
+            std::optional<bool> left_value = as_bool(left);
+            std::optional<bool> right_value = as_bool(right);
+            if (left_value || right_value) {
+                rewrites++;
+                bool constant = left_value ? *left_value : *right_value;
+                if (constant == is_and) {
+                    return left_value ? std::move(node->right) : std::move(node->left);
+                }
+                return std::make_unique<LiteralNode>(!is_and);
+            }
+            return deduplicate(std::move(node), is_and ? "AND" : "OR");
+        }
+        return node;
+    }
+
+    /**
+     * @brief Removes repeated operands from a chain of AND (or OR) terms, keeping the first occurrence.
+     */
+    std::unique_ptr<ExpressionNode> ExpressionRewriter::deduplicate(std::unique_ptr<ExpressionNode> expression,
+                                                                    const char *op) {
+        std::vector<const ExpressionNode *> view;
+        collect_terms(expression.get(), op, view);
+        bool has_duplicates = false;
+        for (size_t i = 1; i < view.size() && !has_duplicates; ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                if (expressions_equal(*view[i], *view[j])) {
+                    has_duplicates = true;
+                    break;
+                }
+            }
+        }
+        if (!has_duplicates) {
+            return expression;
+        }
+
+        std::string op_text = static_cast<BinaryOperationNode *>(expression.get())->op;
+        std::vector<std::unique_ptr<ExpressionNode>> terms;
+        flatten(std::move(expression), op, terms);
+
+        std::vector<std::unique_ptr<ExpressionNode>> unique_terms;
+        for (auto &term : terms) {
+            bool seen = false;
+            for (const auto &kept : unique_terms) {
+                if (expressions_equal(*kept, *term)) {
+                    seen = true;
+                    break;
+                }
+            }
+            if (seen) {
+                rewrites++;
+            } else {
+                unique_terms.push_back(std::move(term));
+            }
+        }
+
+        std::unique_ptr<ExpressionNode> result = std::move(unique_terms[0]);
+        for (size_t i = 1; i < unique_terms.size(); ++i) {
+            result = std::make_unique<BinaryOperationNode>(std::move(result), op_text, std::move(unique_terms[i]));
+        }
+        return result;
+    }
+
+    void ExpressionRewriter::rewrite_where(std::unique_ptr<ExpressionNode> &where_clause) {
+        if (!where_clause) return;
+        where_clause = rewrite(std::move(where_clause));
+        if (as_bool(as_literal(where_clause.get())) == std::optional<bool>(true)) {
+            where_clause.reset();
+        }
+    }
+
+    void ExpressionRewriter::rewrite_statement(ASTNode &statement) {
+        if (auto *select = dynamic_cast<SelectStatementNode *>(&statement)) {
+            for (auto &column : select->columns) {
+                column.expression = rewrite(std::move(column.expression));
+            }
+            for (auto &join : select->join_clause) {
+                join.on_condition = rewrite(std::move(join.on_condition));
+            }
+            rewrite_where(select->where_clause);
+            if (select->group_by && select->group_by->having_clause) {
+                rewrite_where(select->group_by->having_clause);
+            }
+        } else if (auto *update = dynamic_cast<UpdateStatementNode *>(&statement)) {
+            for (auto &set : update->updates) {
+                set.value = rewrite(std::move(set.value));
+            }
+            rewrite_where(update->where_clause);
+        } else if (auto *remove = dynamic_cast<DeleteStatementNode *>(&statement)) {
+            rewrite_where(remove->where_clause);
+        }
+    }
+
+} // namespace minidb
@@ -0,0 +1,107 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "ast.h"
+
+namespace minidb {
+
+    /**
+     * @class ExpressionRewriter
+     * @brief Simplifies expression trees before they are planned and evaluated.
+     *
+     * Generated SQL often carries redundant work that would otherwise be evaluated once per
+     * row. The rewriter applies, bottom up:
+     * - Constant folding: arithmetic, comparisons and AND/OR over literals ('1 + 2' -> 3).
+     * - Arithmetic identities: 'x + 0', '0 + x' and 'x - 0' become 'x', when x is known to be
+     *   numeric and dropping the zero does not change the result type ('int_col + 0.0' is a double).
+     * - Boolean identities: 'x AND TRUE' -> x, 'x AND FALSE' -> FALSE, 'x OR FALSE' -> x, 'x OR TRUE' -> TRUE.
+     * - Duplicate removal: repeated conjuncts or disjuncts ('x = 1 AND x = 1') are kept once.
+     *
+     * Literals of mismatched types are left alone so that the binder can report them.
+     *
+     * @par Usage Example:
+     * @code
+     * auto ast = parser.parse();
+     * ExpressionRewriter().rewrite_statement(*ast);
+     * @endcode
+     */
+    class ExpressionRewriter {
+    public:
+        // Type of a column reference (IdentifierNode or QualifiedIdentifierNode), if known.
+        using ColumnTypeResolver = std::function<std::optional<ValueType>(const ExpressionNode &column)>;
+
+        /**
+         * @param column_type Supplies column types to the arithmetic identities. Without it,
+         *                    an identity is only applied to operands of literal-derived type.
+         */
+        explicit ExpressionRewriter(ColumnTypeResolver column_type = nullptr) : column_type(std::move(column_type)) {}
+
+        /**
+         * @brief Rewrites a single expression tree.
+         * @return The simplified expression. May be the same node, a child, or a new literal.
+         */
+        std::unique_ptr<ExpressionNode> rewrite(std::unique_ptr<ExpressionNode> expression);
+
+        /**
+         * @brief Rewrites every expression in a statement: WHERE, JOIN ... ON, HAVING and UPDATE ... SET values.
+         *
+         * A WHERE clause that folds to TRUE is removed.
+         */
+        void rewrite_statement(ASTNode &statement);
+
+        /// @brief Number of simplifications applied so far.
+        size_t rewrite_count() const { return rewrites; }
+
+    private:
+        std::unique_ptr<ExpressionNode> rewrite_binary(std::unique_ptr<BinaryOperationNode> node);
+        std::unique_ptr<ExpressionNode> deduplicate(std::unique_ptr<ExpressionNode> expression, const char *op);
+        void rewrite_where(std::unique_ptr<ExpressionNode> &where_clause);
+        std::optional<ValueType> static_type(const ExpressionNode &expression) const;
+
+        ColumnTypeResolver column_type;
+
+        size_t rewrites = 0;
+    };
+
+    /**
+     * @brief Structural equality of two expression trees. Operators and keywords compare case-insensitively.
+     */
+    bool expressions_equal(const ExpressionNode &a, const ExpressionNode &b);
+
+    /**
+     * @brief Structural hash consistent with expressions_equal().
+     */
+    size_t expression_hash(const ExpressionNode &expression);
+
+    /**
+     * @brief Finds compound subexpressions that occur more than once in an expression tree.
+     *
+     * An evaluator computes each returned subexpression once per batch and reuses the
+     * result at every occurrence. Only the outermost repeated expression is reported,
+     * not its repeated children.
+     *
+     * @return One representative node per repeated subexpression, in first-seen order.
+     */
+    std::vector<const ExpressionNode *> find_common_subexpressions(const ExpressionNode &expression);
+
+    /**
+     * @brief Splits an expression into its top-level AND-ed terms ('a AND (b AND c)' gives a, b, c).
+     * @param expression May be nullptr, which gives no terms.
+     */
+    std::vector<const ExpressionNode *> split_conjuncts(const ExpressionNode *expression);
+
+    /**
+     * @brief Renders an expression as SQL text, parenthesizing every binary operation.
+     */
+    std::string expression_to_string(const ExpressionNode &expression);
+
+} // namespace minidb
@@ -0,0 +1,78 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file fingerprint.cpp
+ * @brief Statement normalization used to recognise repeated queries.
+ */
+
+#include "fingerprint.h"
+#include <algorithm>
+#include <cctype>
+
+namespace minidb {
+
+    namespace {
+
+        void append_transformed(std::string &out, std::string_view text, int (*transform)(int)) {
+            for (char c : text) {
+                out += static_cast<char>(transform(static_cast<unsigned char>(c)));
+            }
+        }
+
+    } // namespace
+
+    std::string statement_fingerprint(const std::vector<Token> &tokens) {
+        std::string fingerprint;
+        for (const Token &token : tokens) {
+            if (token.type == TokenType::SEMICOLON || token.type == TokenType::EOF_FILE
+                || token.type == TokenType::EOF_TOKEN) {
+                continue;
+            }
+            if (!fingerprint.empty()) {
+                fingerprint += ' ';
+            }
+            switch (token.type) {
+                case TokenType::IDENTIFIER:
+                    append_transformed(fingerprint, token.text, std::tolower);
+                    break;
+                case TokenType::STRING_LITERAL:
+                case TokenType::DATE_LITERAL:
+                case TokenType::TIMESTAMP_LITERAL:
+                    // The token text still has its quotes escaped.
+                    fingerprint += '\'';
+                    fingerprint += token.text;
+                    fingerprint += '\'';
+                    break;
+                case TokenType::INT_LITERAL:
+                case TokenType::FLOAT_LITERAL:
+                    fingerprint += token.text;
+                    break;
+                default:
+                    append_transformed(fingerprint, token.text, std::toupper);
+                    break;
+            }
+        }
+        return fingerprint;
+    }
+
+    std::vector<std::string> referenced_tables(const SelectStatementNode &select) {
+        std::vector<std::string> tables;
+        auto add = [&tables](const std::string &name) {
+            std::string lowered;
+            append_transformed(lowered, name, std::tolower);
+            if (std::find(tables.begin(), tables.end(), lowered) == tables.end()) {
+                tables.push_back(std::move(lowered));
+            }
+        };
+        if (select.from_clause != nullptr) {
+            add(select.from_clause->name->name);
+        }
+        for (const auto &join : select.join_clause) {
+            add(join.table->name->name);
+        }
+        return tables;
+    }
+
+} // namespace minidb
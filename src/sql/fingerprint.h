@@ -0,0 +1,33 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ast.h"
+#include "token.h"
+
+namespace minidb {
+
+    /**
+     * @brief Builds a normalized text form of a tokenized statement.
+     *
+     * Two statements that differ only in whitespace, keyword or identifier case, or a
+     * trailing semicolon get the same fingerprint. Literals are kept exactly, since they
+     * change the result.
+     *
+     * @par Example:
+     * @code
+     * "select  Name from USERS where id = 7;"  ->  "SELECT name FROM users WHERE id = 7"
+     * @endcode
+     */
+    std::string statement_fingerprint(const std::vector<Token> &tokens);
+
+    /**
+     * @brief Lower-cased names of every table a SELECT reads (FROM and JOIN), without duplicates.
+     */
+    std::vector<std::string> referenced_tables(const SelectStatementNode &select);
+
+} // namespace minidb
@@ -14,7 +14,6 @@
 #include "lexer.h"
 #include "token_type_utils.h"
 #include "utils.h"
-#include <regex>
 namespace minidb {
 
     /**
@@ -53,6 +52,9 @@ namespace minidb {
                     return make_token(TokenType::SEMICOLON, ";");
                 case '\'' :
                     return make_string();
+                case '?':
+                case '$':
+                    return make_parameter();
 
                 case '=':
                 case '>':
@@ -117,7 +119,7 @@ namespace minidb {
         }
 
         // If we get here, it's an operator we don't recognize.
-        return {TokenType::UNKNOWN, std::string(1, first_char)};
+        return {TokenType::UNKNOWN, input_.substr(curr_pos - 1, 1)};
     }
 
 
@@ -128,25 +130,42 @@ namespace minidb {
      * @param value The string representation of the token
      * @return Newly created Token with the specified type and value
      */
-    Token Lexer::make_token(TokenType type, const std::string &value) {
+    Token Lexer::make_token(TokenType type, std::string_view value) {
         advance(); // Move cursor ahead
         return {type, value};
     }
 
+    /**
+     * @brief Parses a single-quoted string, date or timestamp literal
+     *
+     * A quote inside the string is written twice ('it''s'). The token text is a view of
+     * the characters between the quotes; unescape_string_literal() collapses the doubled
+     * quotes, so only strings that contain one pay for a copy.
+     *
+     * @return STRING_LITERAL, DATE_LITERAL or TIMESTAMP_LITERAL, or UNKNOWN if the quote is never closed
+     */
     Token Lexer::make_string() {
-        std::string value;
+        size_t quote = curr_pos;
         advance();
-        while (!has_ended() && peek() != '\'') {
-            value += advance();
+        while (true) {
+            while (!has_ended() && peek() != '\'') {
+                advance();
+            }
+            if (curr_pos + 1 < input_.size() && input_[curr_pos + 1] == '\'') {
+                curr_pos += 2; // An escaped quote
+                continue;
+            }
+            break;
         }
 
 		// Check if we hit the end of the file without finding a closing quote
 		if (has_ended()) {
 		  // Return an UNKNOWN token or throw an error.
 		  // For now, let's return UNKNOWN so the parser can handle it or fail gracefully.
-		  return {TokenType::UNKNOWN, "'" + value};
+		  return {TokenType::UNKNOWN, input_.substr(quote)};
 		}
 
+        std::string_view value = input_.substr(quote + 1, curr_pos - quote - 1);
 		advance(); // Consume the closing '
         if (is_date_literal(value)) {
             return {TokenType::DATE_LITERAL, value};
@@ -156,6 +175,27 @@ namespace minidb {
         return {TokenType::STRING_LITERAL, value};
     }
 
+    /**
+     * @brief Parses a parameter placeholder of a prepared statement
+     *
+     * '?' is an anonymous placeholder, numbered by the parser in order of appearance.
+     * '$' must be followed by the parameter number, as in '$1'. The token text is the
+     * placeholder as written.
+     *
+     * @return Token of type PARAMETER, or UNKNOWN for a '$' without a number
+     */
+    Token Lexer::make_parameter() {
+        if (advance() == '?') {
+            return {TokenType::PARAMETER, "?"};
+        }
+        size_t start = curr_pos - 1;
+        while (!has_ended() && isdigit(peek())) {
+            advance();
+        }
+        std::string_view placeholder = input_.substr(start, curr_pos - start);
+        return {placeholder.size() == 1 ? TokenType::UNKNOWN : TokenType::PARAMETER, placeholder};
+    }
+
     /**
      * @brief Parses integer literal tokens
      * 
@@ -166,52 +206,46 @@ namespace minidb {
      * @return Token of type INT_LITERAL, FLOAT_LITERAL with the numeric string
      */
     Token Lexer::make_numbers() {
-        std::string number;
+        size_t start = curr_pos;
         bool is_float = false;
         while (!has_ended() && isdigit(peek())) {
-            number += advance();
+            advance();
         }
 
         if (!has_ended() && peek() == '.') {
             // Check if there is a digit after the dot
             if (curr_pos + 1 < input_.size() && isdigit(input_[curr_pos + 1])) {
                 is_float = true;
-                number += advance(); // consume the dot
+                advance(); // consume the dot
                 while (!has_ended() && isdigit(peek())) {
-                    number += advance();
+                    advance();
                 }
             }
         }
 
-        return {is_float ? TokenType::FLOAT_LITERAL : TokenType::INT_LITERAL, number};
+        return {is_float ? TokenType::FLOAT_LITERAL : TokenType::INT_LITERAL, input_.substr(start, curr_pos - start)};
     }
 
     /**
      * @brief Parses SQL keywords and user-defined identifiers
      * 
      * Collects alphanumeric characters and underscores, then performs
-     * case-insensitive lookup in the keyword map. If found in the keyword
-     * map, returns the corresponding keyword token; otherwise returns an
+     * case-insensitive lookup in the keyword table (see lookup_keyword()). If it
+     * is a keyword, returns the corresponding keyword token; otherwise returns an
      * IDENTIFIER token.
      * 
      * @return Token of appropriate keyword type or IDENTIFIER
      */
     Token Lexer::make_key_or_identifier() {
-        std::string text;
+        size_t start = curr_pos;
         while (!has_ended() && (std::isalnum(peek()) || peek() == '_')) {
-            text += advance();
+            advance();
         }
+        std::string_view text = input_.substr(start, curr_pos - start);
 
-        std::string upper_text = text;
-        std::transform(upper_text.begin(), upper_text.end(), upper_text.begin(),
-                       [](unsigned char c){ return std::toupper(c); });
-
-
-        auto it = keyword_map().find(upper_text);
-        if (it != keyword_map().end()) {
-            return {it->second, text};
+        if (std::optional<TokenType> keyword = lookup_keyword(text)) {
+            return {*keyword, text};
         }
-
         return {TokenType::IDENTIFIER, text};
     }
 
@@ -242,7 +276,7 @@ namespace minidb {
      */
     std::vector<Token> Lexer::tokenize() {
         std::vector<Token> tokens;
-        Token token;
+        Token token{};
         do {
             token = next_token();
             tokens.push_back(token);
@@ -262,11 +296,9 @@ namespace minidb {
      * @return UNKNOWN token containing the unexpected character
      */
     Token Lexer::handle_unexpected_character() {
-        char unexpected_char = advance();
-        
-        // Create UNKNOWN token with the unexpected character
-        std::string error_value(1, unexpected_char);
+        advance();
 
-        return {TokenType::UNKNOWN, error_value};
+        // Create UNKNOWN token with the unexpected character
+        return {TokenType::UNKNOWN, input_.substr(curr_pos - 1, 1)};
     }
 }
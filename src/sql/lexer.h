@@ -23,7 +23,7 @@ namespace minidb {
      * @par Token Recognition:
      * - Keywords: SELECT, FROM, WHERE, JOIN, etc. See token.h enum TokenType for list of keywords we currently support
      * - Identifiers: table names, column names, aliases
-     * - Literals: integers, strings (single-quoted)
+     * - Literals: integers, strings (single-quoted, '' for a quote)
      * - Operators: =, !=, <, >, <=, >=
      * - Punctuation: (, ), ,, ., ;, *
      * 
@@ -31,6 +31,10 @@ namespace minidb {
      * - Unexpected characters generate UNKNOWN tokens with logging
      * - Graceful error recovery allows parsing to continue
      * - Missing string terminators are handled
+     *
+     * @par Memory:
+     * Tokens do not copy their text; Token::text views the input. The input must outlive
+     * both the lexer and every token it returned.
      * 
      * @par Usage Example:
      * @code
@@ -88,7 +92,7 @@ namespace minidb {
              * @param value The string value of the token
              * @return Newly created Token
              */
-            Token make_token(TokenType type, const std::string &value);
+            Token make_token(TokenType type, std::string_view value);
             
             /**
              * @brief Parses comparison and equality operators (=, !=, <, >, <=, >=)
@@ -122,6 +126,8 @@ namespace minidb {
              * @return Token of type STRING_LITERAL with the string content (excluding quotes)
              */
             Token make_string();
+
+            Token make_parameter();
             
             /**
              * @brief Handles unexpected characters encountered during tokenization
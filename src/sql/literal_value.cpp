@@ -0,0 +1,75 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "literal_value.h"
+#include <charconv>
+#include <cstdio>
+#include <tuple>
+
+namespace minidb {
+
+    namespace {
+
+        template<typename T>
+        int three_way(const T &a, const T &b) {
+            return a < b ? -1 : (b < a ? 1 : 0);
+        }
+
+        double to_double(const LiteralValue &value) {
+            if (auto *i = std::get_if<int64_t>(&value)) return static_cast<double>(*i);
+            return std::get<double>(value);
+        }
+
+    } // namespace
+
+    std::optional<int> compare_literals(const LiteralValue &l, const LiteralValue &r) {
+        bool l_numeric = std::holds_alternative<int64_t>(l) || std::holds_alternative<double>(l);
+        bool r_numeric = std::holds_alternative<int64_t>(r) || std::holds_alternative<double>(r);
+        if (l_numeric && r_numeric) {
+            if (std::holds_alternative<int64_t>(l) && std::holds_alternative<int64_t>(r)) {
+                return three_way(std::get<int64_t>(l), std::get<int64_t>(r));
+            }
+            return three_way(to_double(l), to_double(r));
+        }
+        if (l.index() != r.index()) return std::nullopt;
+        if (auto *s = std::get_if<std::string>(&l)) return three_way(*s, std::get<std::string>(r));
+        if (auto *b = std::get_if<bool>(&l)) return three_way(*b, std::get<bool>(r));
+        if (auto *d = std::get_if<SQLDate>(&l)) {
+            const auto &o = std::get<SQLDate>(r);
+            return three_way(std::tie(d->year, d->month, d->day), std::tie(o.year, o.month, o.day));
+        }
+        const auto &a = std::get<SQLTimestamp>(l);
+        const auto &b = std::get<SQLTimestamp>(r);
+        return three_way(std::tie(a.year, a.month, a.day, a.hour, a.minute, a.second),
+                         std::tie(b.year, b.month, b.day, b.hour, b.minute, b.second));
+    }
+
+    std::string literal_to_string(const LiteralValue &value) {
+        if (auto *i = std::get_if<int64_t>(&value)) return std::to_string(*i);
+        if (auto *d = std::get_if<double>(&value)) {
+            char buffer[32];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), *d);
+            return std::string(buffer, result.ptr);
+        }
+        if (auto *b = std::get_if<bool>(&value)) return *b ? "TRUE" : "FALSE";
+        if (auto *s = std::get_if<std::string>(&value)) {
+            std::string quoted = "'";
+            for (char c : *s) {
+                quoted += c;
+                if (c == '\'') quoted += c;
+            }
+            return quoted + "'";
+        }
+        char buffer[32];
+        if (auto *date = std::get_if<SQLDate>(&value)) {
+            std::snprintf(buffer, sizeof(buffer), "'%04d-%02d-%02d'", date->year, date->month, date->day);
+        } else {
+            const auto &ts = std::get<SQLTimestamp>(value);
+            std::snprintf(buffer, sizeof(buffer), "'%04d-%02d-%02d %02d:%02d:%02d'",
+                          ts.year, ts.month, ts.day, ts.hour, ts.minute, ts.second);
+        }
+        return buffer;
+    }
+
+} // namespace minidb
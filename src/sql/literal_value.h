@@ -0,0 +1,43 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <variant>
+
+namespace minidb {
+
+    struct SQLDate {
+        int year, month, day;
+    };
+
+    struct SQLTimestamp {
+        int year, month, day, hour, minute, second;
+    };
+
+    // The set of values a literal (and, later, an evaluated expression) can hold.
+    using LiteralValue = std::variant<int64_t, double, std::string, bool, SQLDate, SQLTimestamp>;
+
+    // The type of a value, in the order of LiteralValue's alternatives.
+    enum class ValueType { INT, FLOAT, STRING, BOOL, DATE, TIMESTAMP };
+
+    inline ValueType value_type(const LiteralValue &value) {
+        return static_cast<ValueType>(value.index());
+    }
+
+    /**
+     * @brief Three-way comparison of two values. Integers and floats compare numerically.
+     * @return Negative, zero or positive, or nullopt if the types cannot be compared.
+     */
+    std::optional<int> compare_literals(const LiteralValue &l, const LiteralValue &r);
+
+    /**
+     * @brief Formats a value as it would be written in SQL: strings, dates and timestamps quoted.
+     */
+    std::string literal_to_string(const LiteralValue &value);
+
+} // namespace minidb
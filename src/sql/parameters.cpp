@@ -0,0 +1,44 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file parameters.cpp
+ * @brief Binding of parameter values to prepared statements.
+ */
+
+#include "parameters.h"
+#include <stdexcept>
+#include <string>
+
+namespace minidb {
+
+    const LiteralValue &parameter_value(const ParameterNode &parameter, const ParameterValues &values) {
+        if (parameter.index == 0 || parameter.index > values.size()) {
+            throw std::runtime_error("No value supplied for parameter $" + std::to_string(parameter.index));
+        }
+        return values[parameter.index - 1];
+    }
+
+    ValueBlock bind_insert_values(const InsertStatementNode &insert, const ParameterValues &values) {
+        ValueBlock rows = insert.values;
+        for (const auto &parameter : insert.parameters) {
+            rows.set(parameter.row, parameter.column, parameter_value(ParameterNode(parameter.index), values));
+        }
+        return rows;
+    }
+
+    ParameterValues execute_arguments(const ExecuteStatementNode &execute, size_t parameter_count) {
+        if (execute.arguments.size() != parameter_count) {
+            throw std::runtime_error("Statement " + execute.name->name + " takes " + std::to_string(parameter_count)
+                                     + " parameters, got " + std::to_string(execute.arguments.size()));
+        }
+        ParameterValues values;
+        values.reserve(execute.arguments.size());
+        for (const auto &argument : execute.arguments) {
+            values.push_back(argument->value);
+        }
+        return values;
+    }
+
+} // namespace minidb
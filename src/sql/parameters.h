@@ -0,0 +1,36 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ast.h"
+
+namespace minidb {
+
+    // Values of a prepared statement's parameters: $1 is element 0.
+    using ParameterValues = std::vector<LiteralValue>;
+
+    /**
+     * @brief The value bound to a placeholder.
+     * @throws std::runtime_error if no value was supplied for it.
+     */
+    const LiteralValue &parameter_value(const ParameterNode &parameter, const ParameterValues &values);
+
+    /**
+     * @brief The rows of an INSERT with every placeholder replaced by its value.
+     *
+     * The statement itself is not modified, so a cached statement can be bound again
+     * for the next execution.
+     */
+    ValueBlock bind_insert_values(const InsertStatementNode &insert, const ParameterValues &values);
+
+    /**
+     * @brief The arguments of an EXECUTE, checked against the prepared statement.
+     * @throws std::runtime_error if the number of arguments differs from parameter_count.
+     */
+    ParameterValues execute_arguments(const ExecuteStatementNode &execute, size_t parameter_count);
+
+} // namespace minidb
@@ -10,21 +10,49 @@
  */
 
 #include "parser.h"
+#include <charconv>
 #include <sstream>
+#include <utility>
+#include "token_type_utils.h"
+#include "utils.h"
 
 
 namespace minidb {
 
-    SQLDate parse_date_literal(const std::string& s) {
-        SQLDate date;
-        std::sscanf(s.c_str(), "%d-%d-%d", &date.year, &date.month, &date.day);
-        return date;
+    // The lexer already validated these literals while telling them from strings. Decoding the
+    // fixed-width text once more here is cheaper than widening every token to carry the value.
+    SQLDate parse_date_literal(std::string_view s) {
+        std::optional<SQLDate> date = decode_date_literal(s);
+        if (!date) {
+            throw std::runtime_error("Invalid date literal: " + std::string(s));
+        }
+        return *date;
     }
 
-    SQLTimestamp parse_timestamp_literal(const std::string& s) {
-        SQLTimestamp ts;
-        std::sscanf(s.c_str(), "%d-%d-%d %d:%d:%d", &ts.year, &ts.month, &ts.day, &ts.hour, &ts.minute, &ts.second);
-        return ts;
+    SQLTimestamp parse_timestamp_literal(std::string_view s) {
+        std::optional<SQLTimestamp> ts = decode_timestamp_literal(s);
+        if (!ts) {
+            throw std::runtime_error("Invalid timestamp literal: " + std::string(s));
+        }
+        return *ts;
+    }
+
+    int64_t parse_int_literal(std::string_view s) {
+        int64_t value = 0;
+        auto [end, error] = std::from_chars(s.data(), s.data() + s.size(), value);
+        if (error != std::errc() || end != s.data() + s.size()) {
+            throw std::runtime_error("Invalid integer literal: " + std::string(s));
+        }
+        return value;
+    }
+
+    double parse_float_literal(std::string_view s) {
+        double value = 0;
+        auto [end, error] = std::from_chars(s.data(), s.data() + s.size(), value);
+        if (error != std::errc() || end != s.data() + s.size()) {
+            throw std::runtime_error("Invalid float literal: " + std::string(s));
+        }
+        return value;
     }
 
     /**
@@ -55,13 +83,40 @@ namespace minidb {
                 return parse_drop_node();
             case TokenType::CREATE:
                 return parse_create_node();
+            case TokenType::ANALYZE:
+                return parse_analyze_node();
+            case TokenType::EXPLAIN:
+                return parse_explain_node();
+            case TokenType::PREPARE:
+                return parse_prepare_node();
+            case TokenType::EXECUTE:
+                return parse_execute_node();
+            case TokenType::DEALLOCATE:
+                return parse_deallocate_node();
             default:
-                throw std::runtime_error("Unsupported statement type: " + peek().text);
+                throw std::runtime_error("Unsupported statement type: " + std::string(peek().text));
         }
         return nullptr; // Should not reach here
 
     }
 
+    std::unique_ptr<ASTNode> Parser::next_statement() {
+        while (match(TokenType::SEMICOLON)) {
+            advance();
+        }
+        if (peek().type == TokenType::EOF_FILE) {
+            return nullptr;
+        }
+        // Placeholders are numbered per statement.
+        anonymous_parameters = 0;
+        highest_parameter = 0;
+        std::unique_ptr<ASTNode> statement = parse();
+        if (peek().type != TokenType::SEMICOLON && peek().type != TokenType::EOF_FILE) {
+            throw std::runtime_error("Expected ';' after statement. Got token with text: " + std::string(peek().text));
+        }
+        return statement;
+    }
+
     /**
      * @brief Parses a complete UPDATE statement.
      * 
@@ -73,7 +128,7 @@ namespace minidb {
         ensure(TokenType::UPDATE, "Expected 'UPDATE' keyword");
         
         auto tableToken = ensure(TokenType::IDENTIFIER, "Expected table name");
-        rootNode->table_name = std::make_unique<IdentifierNode>(tableToken.text);
+        rootNode->table_name = std::make_unique<IdentifierNode>(std::string(tableToken.text));
 
         ensure(TokenType::SET, "Expected 'SET' keyword");
 
@@ -84,7 +139,7 @@ namespace minidb {
 
             UpdateStatementNode::UpdateSet updateSet;
             auto colToken = ensure(TokenType::IDENTIFIER, "Expected column name");
-            updateSet.column = std::make_unique<IdentifierNode>(colToken.text);
+            updateSet.column = std::make_unique<IdentifierNode>(std::string(colToken.text));
 
             ensure(TokenType::EQ, "Expected '=' after column name");
 
@@ -105,7 +160,7 @@ namespace minidb {
      * @brief Parses a complete SELECT statement with all clauses
      * 
      * Handles the full SELECT statement syntax:
-     * SELECT { * | column_list } FROM table_ref [JOIN table_ref ON condition] [WHERE condition]
+     * SELECT { * | column_list } FROM table_ref [JOIN table_ref ON condition]... [WHERE condition]
      * 
      * @return SelectStatementNode containing all parsed components
      */
@@ -125,8 +180,7 @@ namespace minidb {
 
         rootNode->from_clause = parse_from_table_ref();
 
-        // We will support only single join in the first implementation
-        if (match(TokenType::JOIN)) {
+        while (match(TokenType::JOIN)) {
             SelectStatementNode::JoinClause join_clause;
             advance();
             join_clause.table = parse_from_table_ref();
@@ -143,7 +197,7 @@ namespace minidb {
 
         if (match(TokenType::GROUP)) {
             advance();
-            ensure(TokenType::BY, "Expected 'By' keyword after GROUP. Instead found "+ tokens[pos].text);
+            ensure(TokenType::BY, "Expected 'By' keyword after GROUP. Instead found " + std::string(peek().text));
             rootNode->group_by = parse_group_by_clause();
         }
         return rootNode;
@@ -154,7 +208,7 @@ namespace minidb {
 	  	ensure(TokenType::INSERT,  "Expected 'INSERT' keyword.");
 	  	ensure(TokenType::INTO, "Expected INTO keyword ");
 	  	const Token& tableNameToken = ensure(TokenType::IDENTIFIER, "Expected Identifier for table name");
-	  	rootNode->tableName = std::make_unique<IdentifierNode>(tableNameToken.text);
+	  	rootNode->tableName = std::make_unique<IdentifierNode>(std::string(tableNameToken.text));
 
 		// If we find column names
 		if (match(TokenType::LPAREN)) {
@@ -168,19 +222,57 @@ namespace minidb {
 
 		if (match(TokenType::VALUES)) {
 			this->advance();
+			// Each row is parsed into `row` and then appended column by column; the buffer
+			// is reused, so a long VALUES list allocates nothing per value beyond long strings.
+			std::vector<LiteralValue> row;
+			row.reserve(rootNode->columnNames.size());
+			std::vector<std::pair<size_t, size_t>> parameters;
+			ValueBlock &values = rootNode->values;
 			do {
 			  if (match(TokenType::COMMA)) {
 				advance();
 			  }
-			  rootNode->values.push_back(parse_value_list());
+			  parameters.clear();
+			  parse_value_list(row, &parameters);
+
+			  // Validate the arity of every row here, so the executor can insert
+			  // the rows as a batch without checking each one.
+			  size_t expected = values.row_count() > 0 ? values.column_count()
+													   : rootNode->columnNames.empty() ? row.size()
+																					   : rootNode->columnNames.size();
+			  if (row.size() != expected) {
+				throw std::runtime_error("VALUES row " + std::to_string(values.row_count() + 1) + " has "
+										 + std::to_string(row.size()) + " values, expected "
+										 + std::to_string(expected));
+			  }
+			  if (values.row_count() == 0) {
+				values.reserve_columns(expected);
+			  }
+			  auto parameter = parameters.begin();
+			  for (size_t column = 0; column < row.size(); column++) {
+				if (parameter != parameters.end() && parameter->first == column) {
+				  rootNode->parameters.push_back({values.row_count(), column, parameter->second});
+				  values.append_placeholder();
+				  ++parameter;
+				} else {
+				  values.append(std::move(row[column]));
+				}
+			  }
+			  values.end_row();
 			} while (match(TokenType::COMMA));
 		}
 		return rootNode;
 	}
 
-std::vector<std::unique_ptr<LiteralNode>> Parser::parse_value_list() {
+/**
+ * @brief Parses a parenthesized list of literal values.
+ *
+ * @param parameters If not null, placeholders are accepted: each one leaves a default slot
+ * in the result and its (column, parameter number) is appended here.
+ */
+void Parser::parse_value_list(std::vector<LiteralValue> &values, std::vector<std::pair<size_t, size_t>> *parameters) {
 		ensure(TokenType::LPAREN, "Expected ( ");
-		std::vector<std::unique_ptr<LiteralNode>> values;
+		values.clear();
 		
 		do {
 			if (match(TokenType::COMMA)) {
@@ -188,32 +280,38 @@ std::vector<std::unique_ptr<LiteralNode>> Parser::parse_value_list() {
 			}
 			switch (peek().type) {
 				case TokenType::INT_LITERAL:
-					values.push_back(std::make_unique<LiteralNode>(std::stoll(peek().text)));
+					values.emplace_back(parse_int_literal(peek().text));
 					break;
 				case TokenType::FLOAT_LITERAL:
-					values.push_back(std::make_unique<LiteralNode>(std::stod(peek().text)));
+					values.emplace_back(parse_float_literal(peek().text));
 					break;
 				case TokenType::DATE_LITERAL:
-					values.push_back(std::make_unique<LiteralNode>(parse_date_literal(peek().text)));
+					values.emplace_back(parse_date_literal(peek().text));
 					break;
 				case TokenType::TIMESTAMP_LITERAL:
-					values.push_back(std::make_unique<LiteralNode>(parse_timestamp_literal(peek().text)));
+					values.emplace_back(parse_timestamp_literal(peek().text));
 					break;
 				case TokenType::STRING_LITERAL:
-					values.push_back(std::make_unique<LiteralNode>(peek().text));
+					values.emplace_back(unescape_string_literal(peek().text));
 					break;
 				case TokenType::TRUE:
-					values.push_back(std::make_unique<LiteralNode>(true));
+					values.emplace_back(true);
 					break;
 				case TokenType::FALSE:
-					values.push_back(std::make_unique<LiteralNode>(false));
+					values.emplace_back(false);
 					break;
+				case TokenType::PARAMETER:
+					if (parameters == nullptr) {
+						throw std::runtime_error("Parameter " + std::string(peek().text) + " is not allowed here");
+					}
+					parameters->emplace_back(values.size(), parse_parameter());
+					values.emplace_back();
+					continue;
 			}
 			advance();
 		} while (match(TokenType::COMMA));
 		
 		ensure(TokenType::RPAREN, "Expected )");
-		return values;
 	}
 
 std::unique_ptr<ASTNode> Parser::parse_create_node() {
@@ -222,15 +320,40 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
             return parse_create_table_node();
         } else if (match(TokenType::INDEX)) {
             return parse_create_index_node();
+        } else if (match(TokenType::MATERIALIZED)) {
+            return parse_create_materialized_view_node();
+        }
+        throw std::runtime_error("Expected TABLE, INDEX or MATERIALIZED VIEW after CREATE");
+    }
+
+    /**
+     * @brief Parses CREATE MATERIALIZED VIEW view_name AS SELECT ...
+     *
+     * Only the syntax is checked here. Whether the query can be maintained incrementally
+     * is decided when the view is built.
+     */
+    std::unique_ptr<ASTNode> Parser::parse_create_materialized_view_node() {
+        auto rootNode = std::make_unique<CreateMaterializedViewStatementNode>();
+        ensure(TokenType::MATERIALIZED, "Expected 'MATERIALIZED' keyword");
+        ensure(TokenType::VIEW, "Expected 'VIEW' keyword after MATERIALIZED");
+
+        auto viewToken = ensure(TokenType::IDENTIFIER, "Expected view name");
+        rootNode->view_name = std::make_unique<IdentifierNode>(std::string(viewToken.text));
+
+        ensure(TokenType::AS, "Expected 'AS' after view name");
+        if (!match(TokenType::SELECT)) {
+            throw std::runtime_error("Expected SELECT query for materialized view. Got token with text: " + std::string(peek().text));
         }
-        throw std::runtime_error("Expected TABLE or INDEX after CREATE");
+        auto query = parse_select_node();
+        rootNode->query.reset(static_cast<SelectStatementNode *>(query.release()));
+        return rootNode;
     }
 
 	std::unique_ptr<ASTNode> Parser::parse_create_table_node() {
 	  auto rootNode = std::make_unique<CreateTableStatementNode>();
 	  ensure(TokenType::TABLE, "Expected token Table ");
 	  auto tableName = ensure(TokenType::IDENTIFIER, "Expected table name");
-	  rootNode->table_name = std::make_unique<IdentifierNode>(tableName.text);
+	  rootNode->table_name = std::make_unique<IdentifierNode>(std::string(tableName.text));
 
 	  ensure(TokenType::LPAREN, "Expected token ( ");
 
@@ -246,7 +369,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
 
 		  // Parse column name
 		  auto columnName = ensure(TokenType::IDENTIFIER, "Expected column name");
-		  columnDef->name = std::make_unique<IdentifierNode>(columnName.text);
+		  columnDef->name = std::make_unique<IdentifierNode>(std::string(columnName.text));
 
 		  if (match(TokenType::INT)) {
 			columnDef->type = TokenType::INT;
@@ -269,17 +392,17 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
 			if (match(TokenType::LPAREN)) {
 			  advance(); // consume '('
 			  auto sizeToken = ensure(TokenType::INT_LITERAL, "Expected size for VARCHAR");
-			  columnDef->size = std::stoi(sizeToken.text);
+			  columnDef->size = static_cast<int>(parse_int_literal(sizeToken.text));
 			  ensure(TokenType::RPAREN, "Expected ')' after VARCHAR size");
 			}
 		  } else {
-			throw std::runtime_error("Unexpected Column type specified. Found " + peek().text);
+			throw std::runtime_error("Unexpected Column type specified. Found " + std::string(peek().text));
 		  }
 
 		  if (match(TokenType::PRIMARY)) {
 			advance();
 			ensure(TokenType::KEY, "Expected token KEY");
-			rootNode->primary_key_columns.push_back(std::make_unique<IdentifierNode>(columnName.text));
+			rootNode->primary_key_columns.push_back(std::make_unique<IdentifierNode>(std::string(columnName.text)));
 		  }
 		  rootNode->columns.push_back(std::move(columnDef));
 		}
@@ -293,7 +416,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
 			  advance();
 			}
 			if (match(TokenType::IDENTIFIER)) {
-			  rootNode->primary_key_columns.push_back(std::make_unique<IdentifierNode>(tokens[pos].text));
+			  rootNode->primary_key_columns.push_back(std::make_unique<IdentifierNode>(std::string(peek().text)));
 			  advance();
 			}
 		  } while (match(TokenType::COMMA));
@@ -313,12 +436,12 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
         ensure(TokenType::INDEX, "Expected 'INDEX' keyword");
         
         auto indexToken = ensure(TokenType::IDENTIFIER, "Expected index name");
-        rootNode->index_name = std::make_unique<IdentifierNode>(indexToken.text);
+        rootNode->index_name = std::make_unique<IdentifierNode>(std::string(indexToken.text));
 
         ensure(TokenType::ON, "Expected 'ON' keyword");
 
         auto tableToken = ensure(TokenType::IDENTIFIER, "Expected table name");
-        rootNode->table_name = std::make_unique<IdentifierNode>(tableToken.text);
+        rootNode->table_name = std::make_unique<IdentifierNode>(std::string(tableToken.text));
 
         ensure(TokenType::LPAREN, "Expected '(' before column list");
         
@@ -341,7 +464,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
         ensure(TokenType::FROM, "Expected 'FROM' keyword");
         
         const auto& tableToken = ensure(TokenType::IDENTIFIER, "Expected table name");
-        rootNode->table_name = std::make_unique<IdentifierNode>(tableToken.text);
+        rootNode->table_name = std::make_unique<IdentifierNode>(std::string(tableToken.text));
 
         if (match(TokenType::WHERE)) {
             advance();
@@ -362,7 +485,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
         auto rootNode = std::make_unique<DropTableStatementNode>();
         advance(); // Advance past the drop token
         // Confirm drop is followed by TABLE
-        ensure(TokenType::TABLE, "Expected 'TABLE' keyword after DROP. Instead found " + peek().text);
+        ensure(TokenType::TABLE, "Expected 'TABLE' keyword after DROP. Instead found " + std::string(peek().text));
         if (match(TokenType::IF)) {
             advance();
             ensure(TokenType::EXISTS, "Expected 'Exists' keyword after IF.");
@@ -374,6 +497,129 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
         return rootNode;
     }
 
+    /**
+     * @brief Parses an ANALYZE statement.
+     *
+     * Syntax:
+     * ANALYZE [table_name [(col1, col2, ...)]]
+     */
+    std::unique_ptr<ASTNode> Parser::parse_analyze_node() {
+        auto rootNode = std::make_unique<AnalyzeStatementNode>();
+        ensure(TokenType::ANALYZE, "Expected 'ANALYZE' keyword");
+        if (!match(TokenType::IDENTIFIER)) {
+            return rootNode;
+        }
+        rootNode->table_name = std::make_unique<IdentifierNode>(std::string(advance().text));
+        if (match(TokenType::LPAREN)) {
+            advance();
+            rootNode->columns = parse_identifier_list();
+            ensure(TokenType::RPAREN, "Expected ')' after column list");
+        }
+        return rootNode;
+    }
+
+    /**
+     * @brief Parses an EXPLAIN statement.
+     *
+     * Syntax:
+     * EXPLAIN [ANALYZE] statement
+     */
+    std::unique_ptr<ASTNode> Parser::parse_explain_node() {
+        auto rootNode = std::make_unique<ExplainStatementNode>();
+        ensure(TokenType::EXPLAIN, "Expected 'EXPLAIN' keyword");
+        if (match(TokenType::ANALYZE)) {
+            advance();
+            rootNode->analyze = true;
+        }
+        if (match(TokenType::EXPLAIN) || match(TokenType::ANALYZE)) {
+            throw std::runtime_error("Cannot EXPLAIN " + std::string(peek().text));
+        }
+        rootNode->statement = parse();
+        return rootNode;
+    }
+
+    /**
+     * @brief Parses a PREPARE statement.
+     *
+     * Syntax:
+     * PREPARE name AS { SELECT | INSERT | UPDATE | DELETE } ...
+     */
+    std::unique_ptr<ASTNode> Parser::parse_prepare_node() {
+        auto rootNode = std::make_unique<PrepareStatementNode>();
+        ensure(TokenType::PREPARE, "Expected 'PREPARE' keyword");
+        rootNode->name = std::make_unique<IdentifierNode>(std::string(ensure(TokenType::IDENTIFIER, "Expected statement name").text));
+        ensure(TokenType::AS, "Expected 'AS' after statement name");
+        if (!match(TokenType::SELECT) && !match(TokenType::INSERT) && !match(TokenType::UPDATE)
+            && !match(TokenType::DELETE)) {
+            throw std::runtime_error("Cannot PREPARE " + std::string(peek().text));
+        }
+        // The prepared statement numbers its placeholders on its own; PREPARE itself takes none.
+        size_t outer_anonymous = std::exchange(anonymous_parameters, 0);
+        size_t outer_highest = std::exchange(highest_parameter, 0);
+        rootNode->statement = parse();
+        rootNode->parameter_count = parameter_count();
+        anonymous_parameters = outer_anonymous;
+        highest_parameter = outer_highest;
+        return rootNode;
+    }
+
+    /**
+     * @brief Parses an EXECUTE statement.
+     *
+     * Syntax:
+     * EXECUTE name [(value1, value2, ...)]
+     */
+    std::unique_ptr<ASTNode> Parser::parse_execute_node() {
+        auto rootNode = std::make_unique<ExecuteStatementNode>();
+        ensure(TokenType::EXECUTE, "Expected 'EXECUTE' keyword");
+        rootNode->name = std::make_unique<IdentifierNode>(std::string(ensure(TokenType::IDENTIFIER, "Expected statement name").text));
+        if (match(TokenType::LPAREN)) {
+            std::vector<LiteralValue> arguments;
+            parse_value_list(arguments);
+            for (auto &argument : arguments) {
+                rootNode->arguments.push_back(std::make_unique<LiteralNode>(std::move(argument)));
+            }
+        }
+        return rootNode;
+    }
+
+    /**
+     * @brief Parses a DEALLOCATE statement.
+     *
+     * Syntax:
+     * DEALLOCATE name
+     */
+    std::unique_ptr<ASTNode> Parser::parse_deallocate_node() {
+        auto rootNode = std::make_unique<DeallocateStatementNode>();
+        ensure(TokenType::DEALLOCATE, "Expected 'DEALLOCATE' keyword");
+        rootNode->name = std::make_unique<IdentifierNode>(std::string(ensure(TokenType::IDENTIFIER, "Expected statement name").text));
+        return rootNode;
+    }
+
+    /**
+     * @brief Consumes a placeholder and returns its 1-based parameter number.
+     *
+     * Each '?' takes the next number. A statement may use '?' or '$n', not both.
+     */
+    size_t Parser::parse_parameter() {
+        std::string_view text = ensure(TokenType::PARAMETER, "Expected parameter").text;
+        if (text == "?") {
+            if (highest_parameter > 0) {
+                throw std::runtime_error("Cannot mix '?' and '$n' parameters");
+            }
+            return ++anonymous_parameters;
+        }
+        if (anonymous_parameters > 0) {
+            throw std::runtime_error("Cannot mix '?' and '$n' parameters");
+        }
+        size_t index = static_cast<size_t>(parse_int_literal(text.substr(1)));
+        if (index == 0) {
+            throw std::runtime_error("Parameter numbers start at $1");
+        }
+        highest_parameter = std::max(highest_parameter, index);
+        return index;
+    }
+
     std::vector<std::unique_ptr<IdentifierNode>> Parser::parse_identifier_list() {
         std::vector<std::unique_ptr<IdentifierNode>> identifiers;
         do {
@@ -381,7 +627,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
                 advance();
             }
             identifiers.push_back(
-                    std::make_unique<IdentifierNode>(ensure(TokenType::IDENTIFIER, "Expected table name.").text)
+                    std::make_unique<IdentifierNode>(std::string(ensure(TokenType::IDENTIFIER, "Expected table name.").text))
             );
         } while (match(TokenType::COMMA));
         return identifiers;
@@ -419,7 +665,8 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
      * @return true if current token matches type and we're not at end, false otherwise
      */
     bool Parser::match(TokenType type) {
-        return !(is_at_end() || peek().type != type);
+        if (is_at_end()) return false;
+        return peek().type == type || (type == TokenType::IDENTIFIER && is_non_reserved_keyword(peek().type));
     }
 
     /**
@@ -466,8 +713,8 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
      * @throws std::runtime_error if token type doesn't match expectation
      */
     const Token &Parser::ensure(TokenType type, const std::string &message) {
-        if (peek().type == type) return advance();
-        throw std::runtime_error(message + " Got token with text: " + peek().text);
+        if (match(type)) return advance();
+        throw std::runtime_error(message + " Got token with text: " + std::string(peek().text));
     }
 
     /**
@@ -481,14 +728,17 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
      */
     std::unique_ptr<ExpressionNode> Parser::extract_column() {
         if (!match(TokenType::IDENTIFIER)) {
-            throw std::runtime_error("Expected identifier instead found " + peek().text);
+            throw std::runtime_error("Expected identifier instead found " + std::string(peek().text));
         } else {
-            std::string name = advance().text;
+            std::string name(advance().text);
+            if (match(TokenType::LPAREN)) {
+                return parse_function_call(name);
+            }
             if (match(TokenType::DOT)) {
                 auto qualifier = std::make_unique<IdentifierNode>(name);
                 advance();
                 auto member_name = ensure(TokenType::IDENTIFIER, "Expected column name after '.'").text;
-                auto member = std::make_unique<IdentifierNode>(member_name);
+                auto member = std::make_unique<IdentifierNode>(std::string(member_name));
                 return std::make_unique<QualifiedIdentifierNode>(std::move(qualifier), std::move(member));
             } else {
                 return std::make_unique<IdentifierNode>(name);
@@ -508,13 +758,13 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
      */
     std::unique_ptr<SelectStatementNode::TableReference> Parser::parse_from_table_ref() {
         auto table_ref = std::make_unique<SelectStatementNode::TableReference>();
-        table_ref->name = std::make_unique<IdentifierNode>(ensure(TokenType::IDENTIFIER, "Expected table name.").text);
+        table_ref->name = std::make_unique<IdentifierNode>(std::string(ensure(TokenType::IDENTIFIER, "Expected table name.").text));
 
 
         if (match(TokenType::AS)) {
             advance(); // Consume the AS token
             table_ref->alias = ensure(TokenType::IDENTIFIER, "Expected alias for table.").text;
-        } else if (peek().type == TokenType::IDENTIFIER) {
+        } else if (match(TokenType::IDENTIFIER)) {
             table_ref->alias = advance().text;
         }
         return table_ref;
@@ -528,9 +778,10 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
      * level in the operator precedence hierarchy.
      * 
      * Operator precedence (highest to lowest):
-     * 1. Comparison operators (=, !=, <, >, <=, >=)
-     * 2. AND
-     * 3. OR
+     * 1. Additive operators (+, -)
+     * 2. Comparison operators (=, !=, <, >, <=, >=)
+     * 3. AND
+     * 4. OR
      * 
      * @return ExpressionNode representing the complete parsed expression
      */
@@ -539,7 +790,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
 
         while (match(TokenType::OR)) {
             advance();
-            std::string op = tokens[pos - 1].text;
+            std::string op(previous().text);
             auto right = parse_and_expression();
             left = std::make_unique<BinaryOperationNode>(std::move(left), op, std::move(right));
         }
@@ -551,7 +802,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
 
         while (match(TokenType::AND)) {
             advance();
-            std::string op = tokens[pos - 1].text;
+            std::string op(previous().text);
             auto right = parse_relational_expression();
             left = std::make_unique<BinaryOperationNode>(std::move(left), op, std::move(right));
         }
@@ -559,50 +810,91 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
     }
 
     std::unique_ptr<ExpressionNode> Parser::parse_relational_expression() {
-        auto left = parse_value_or_identifier();
+        auto left = parse_additive_expression();
 
         while (peek().type == TokenType::EQ || peek().type == TokenType::NE ||
                peek().type == TokenType::LT || peek().type == TokenType::LTE ||
                peek().type == TokenType::GT || peek().type == TokenType::GTE) {
-            std::string op = advance().text;
+            std::string op(advance().text);
+            auto right = parse_additive_expression();
+            left = std::make_unique<BinaryOperationNode>(std::move(left), op, std::move(right));
+        }
+        return left;
+    }
+
+    /**
+     * @brief Parses left-associative addition and subtraction, e.g. 'price + tax - discount'.
+     */
+    std::unique_ptr<ExpressionNode> Parser::parse_additive_expression() {
+        auto left = parse_value_or_identifier();
+
+        while (peek().type == TokenType::PLUS || peek().type == TokenType::MINUS) {
+            std::string op(advance().text);
             auto right = parse_value_or_identifier();
             left = std::make_unique<BinaryOperationNode>(std::move(left), op, std::move(right));
         }
         return left;
     }
 
+    /**
+     * @brief Parses the argument list of a function call whose name has been consumed.
+     *
+     * Accepts 'name(*)', 'name()' and 'name(expr, ...)'.
+     */
+    std::unique_ptr<ExpressionNode> Parser::parse_function_call(const std::string &name) {
+        auto call = std::make_unique<FunctionCallNode>(name);
+        ensure(TokenType::LPAREN, "Expected '(' after function name.");
+        if (match(TokenType::STAR)) {
+            advance();
+            call->is_star_argument = true;
+        } else if (!match(TokenType::RPAREN)) {
+            call->arguments = parse_expression_list();
+        }
+        ensure(TokenType::RPAREN, "Expected ')' after function arguments.");
+        return call;
+    }
+
     std::unique_ptr<ExpressionNode> Parser::parse_value_or_identifier() {
         if (match(TokenType::INT_LITERAL)) {
             advance();
-            int64_t val = std::stoll(tokens[pos - 1].text);
+            int64_t val = parse_int_literal(previous().text);
             return std::make_unique<LiteralNode>(val);
         }
         if (match(TokenType::FLOAT_LITERAL)) {
             advance();
-            double val = std::stod(tokens[pos - 1].text);
+            double val = parse_float_literal(previous().text);
             return std::make_unique<LiteralNode>(val);
         }
         if (match(TokenType::DATE_LITERAL)) {
             advance();
-            return std::make_unique<LiteralNode>(parse_date_literal(tokens[pos - 1].text));
+            return std::make_unique<LiteralNode>(parse_date_literal(previous().text));
         }
         if (match(TokenType::TIMESTAMP_LITERAL)) {
             advance();
-            return std::make_unique<LiteralNode>(parse_timestamp_literal(tokens[pos - 1].text));
+            return std::make_unique<LiteralNode>(parse_timestamp_literal(previous().text));
         }
         if (match(TokenType::STRING_LITERAL)) {
             advance();
-            return std::make_unique<LiteralNode>(tokens[pos - 1].text);
+            return std::make_unique<LiteralNode>(unescape_string_literal(previous().text));
+        }
+        if (match(TokenType::TRUE) || match(TokenType::FALSE)) {
+            return std::make_unique<LiteralNode>(advance().type == TokenType::TRUE);
+        }
+        if (match(TokenType::PARAMETER)) {
+            return std::make_unique<ParameterNode>(parse_parameter());
         }
 
         if (match(TokenType::IDENTIFIER)) {
             advance();
-            std::string name = tokens[pos - 1].text;
+            std::string name(previous().text);
+            if (match(TokenType::LPAREN)) {
+                return parse_function_call(name);
+            }
             if (match(TokenType::DOT)) {
                 advance();
                 auto qualifier = std::make_unique<IdentifierNode>(name);
                 auto member_name = ensure(TokenType::IDENTIFIER, "Expected column name after '.'").text;
-                auto member = std::make_unique<IdentifierNode>(member_name);
+                auto member = std::make_unique<IdentifierNode>(std::string(member_name));
                 return std::make_unique<QualifiedIdentifierNode>(std::move(qualifier), std::move(member));
             }
             return std::make_unique<IdentifierNode>(name);
@@ -615,7 +907,7 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
             return expr;
         }
 
-        throw std::runtime_error("Unexpected token in expression: " + peek().text);
+        throw std::runtime_error("Unexpected token in expression: " + std::string(peek().text));
     }
 
 
@@ -629,11 +921,8 @@ std::unique_ptr<ASTNode> Parser::parse_create_node() {
      * @return Reference to the consumed token
      * @throws std::out_of_range if attempting to advance past end of tokens
      */
-    Token &Parser::advance() {
-        if (!is_at_end()) {
-            return tokens[pos++];
-        }
-        throw std::out_of_range("Cannot advance past the end of tokens.");
+    const Token &Parser::advance() {
+        return tokens.advance();
     }
 }
 
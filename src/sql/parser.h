@@ -3,9 +3,11 @@
 //
 
 #pragma once
+#include <algorithm>
 #include <string>
 #include "lexer.h"
 #include "token.h"
+#include "token_source.h"
 #include "ast.h"
 
 namespace minidb {
@@ -29,6 +31,7 @@ namespace minidb {
      * - OR expressions (lowest precedence)
      * - AND expressions (higher precedence)
      * - Comparison expressions (=, !=, <, >, <=, >=)
+     * - Additive expressions (+, -)
      * 
      * @par Error Handling:
      * - Throws std::runtime_error for syntax errors
@@ -41,6 +44,16 @@ namespace minidb {
      * Parser parser(std::move(tokens));
      * auto ast = parser.parse();
      * @endcode
+     *
+     * A script is parsed straight from the lexer, one statement at a time, without
+     * tokenizing it up front:
+     * @code
+     * Lexer lexer(script);
+     * Parser parser(lexer);
+     * while (auto statement = parser.next_statement()) {
+     *     execute(*statement);
+     * }
+     * @endcode
      */
     class Parser {
         public:
@@ -48,7 +61,14 @@ namespace minidb {
              * @brief Constructs a Parser with a vector of tokens
              * @param tokens Vector of tokens to parse (typically from Lexer::tokenize())
              */
-            explicit Parser(std::vector<Token> tokens) : tokens(std::move(tokens)), pos(0) {
+            explicit Parser(std::vector<Token> tokens) : tokens(std::move(tokens)) {
+            }
+
+            /**
+             * @brief Constructs a Parser that pulls tokens from the lexer as it goes
+             * @param lexer Lexer over the input; it and its input must outlive the parser
+             */
+            explicit Parser(Lexer &lexer) : tokens(lexer) {
             }
 
             /**
@@ -58,23 +78,46 @@ namespace minidb {
              */
             std::unique_ptr<ASTNode> parse();
 
+            /**
+             * @brief Parses the next statement of a ';'-separated script
+             * @return The statement, or nullptr once the script is exhausted
+             * @throws std::runtime_error for syntax errors, or a statement not followed by ';'
+             */
+            std::unique_ptr<ASTNode> next_statement();
+
+            /**
+             * @brief Number of parameters the last parsed statement takes: the highest '$n', or
+             * the number of '?' placeholders.
+             */
+            size_t parameter_count() const {
+                return std::max(anonymous_parameters, highest_parameter);
+            }
+
         private:
-            std::vector<Token> tokens;  ///< Token stream to parse
-            int pos;                   ///< Current position in the token stream
+            TokenSource tokens;        ///< Token stream to parse
+            size_t anonymous_parameters = 0; ///< '?' placeholders seen so far
+            size_t highest_parameter = 0;    ///< Highest '$n' placeholder seen so far
 
             /**
              * @brief Consumes and returns the current token, advancing the position
              * @return Reference to the consumed token
              * @throws std::out_of_range if attempting to advance past end of tokens
              */
-            Token& advance();
+            const Token& advance();
 
             /**
              * @brief Returns the current token without consuming it
              * @return Reference to the current token
              */
-            inline Token& peek() {
-                return tokens[pos];
+            inline const Token& peek() {
+                return tokens.peek();
+            }
+
+            /**
+             * @brief Returns the token consumed by the last advance()
+             */
+            inline const Token& previous() const {
+                return tokens.previous();
             }
 
             /**
@@ -82,7 +125,7 @@ namespace minidb {
              * @return true if at end of tokens, false otherwise
              */
             inline bool is_at_end() {
-                return pos >= tokens.size();
+                return tokens.at_end();
             }
 
             /**
@@ -132,13 +175,18 @@ namespace minidb {
             std::unique_ptr<ExpressionNode> parse_and_expression();
             std::unique_ptr<ExpressionNode> parse_value_or_identifier();
             std::unique_ptr<ExpressionNode> parse_relational_expression();
+            std::unique_ptr<ExpressionNode> parse_additive_expression();
+            std::unique_ptr<ExpressionNode> parse_function_call(const std::string &name);
             std::vector<std::unique_ptr<ExpressionNode>> parse_expression_list();
 
             /**
              * @brief Parses a comma-separated list of literal values enclosed in parentheses
-             * @return Vector of LiteralNode pointers representing the parsed values
+             * @param values Receives the parsed values; cleared first
              */
-            std::vector<std::unique_ptr<LiteralNode>> parse_value_list();
+            void parse_value_list(std::vector<LiteralValue> &values,
+                                  std::vector<std::pair<size_t, size_t>> *parameters = nullptr);
+
+            size_t parse_parameter();
 
             // Future statement parsers (not yet implemented)
             std::unique_ptr<ASTNode> parse_insert_node();
@@ -147,10 +195,19 @@ namespace minidb {
             std::unique_ptr<ASTNode> parse_create_node();
             std::unique_ptr<ASTNode> parse_create_table_node();
             std::unique_ptr<ASTNode> parse_create_index_node();
+            std::unique_ptr<ASTNode> parse_create_materialized_view_node();
             std::unique_ptr<ASTNode> parse_drop_node();
+            std::unique_ptr<ASTNode> parse_analyze_node();
+            std::unique_ptr<ASTNode> parse_explain_node();
+            std::unique_ptr<ASTNode> parse_prepare_node();
+            std::unique_ptr<ASTNode> parse_execute_node();
+            std::unique_ptr<ASTNode> parse_deallocate_node();
 
             /**
              * @brief Checks if current token matches the given type without consuming it
+             *
+             * IDENTIFIER also matches the non-reserved keywords, so they can name tables and columns.
+             *
              * @param type TokenType to match against
              * @return true if current token matches type and we're not at end, false otherwise
              */
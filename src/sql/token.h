@@ -3,6 +3,7 @@
 //
 #pragma once
 #include <string>
+#include <string_view>
 #include "iostream"
 
 namespace minidb {
@@ -17,6 +18,7 @@ namespace minidb {
         STRING_LITERAL,
         BOOL_LITERAL,
         NULL_LITERAL,
+        PARAMETER,          // ? or $n placeholder in a prepared statement
 
         // Keywords
         SELECT, FROM, WHERE, INSERT, INTO, VALUES,
@@ -24,6 +26,8 @@ namespace minidb {
         INT, FLOAT, VARCHAR, BOOL, DATE, TIMESTAMP, JOIN,
         ON, GROUP, BY, HAVING, ORDER, ASC, DESC,
         IF, EXISTS, PRIMARY, KEY,
+        MATERIALIZED, VIEW, ANALYZE, EXPLAIN,
+        PREPARE, EXECUTE, DEALLOCATE,
 
         // Operators
         EQ, NE, GT, LT, GTE, LTE,
@@ -50,7 +54,8 @@ namespace minidb {
 
     struct Token {
         TokenType type;
-        std::string text;
-        ~Token() = default;
+        // Points into the lexed input, which must outlive the token. For a string literal
+        // this is the text between the quotes, with any '' escapes still doubled.
+        std::string_view text;
     };
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file token_source.cpp
+ * @brief Ring-buffered token stream between the lexer and the parser.
+ */
+
+#include "token_source.h"
+#include <stdexcept>
+
+namespace minidb {
+
+    TokenSource::TokenSource(std::vector<Token> tokens) : tokens(std::move(tokens)) {
+        if (this->tokens.empty() || this->tokens.back().type != TokenType::EOF_FILE) {
+            this->tokens.push_back({TokenType::EOF_FILE, ""});
+        }
+    }
+
+    Token TokenSource::pull() {
+        if (eof_position) {
+            return {TokenType::EOF_FILE, ""};
+        }
+        Token token = lexer != nullptr ? lexer->next_token() : tokens[next_index++];
+        if (token.type == TokenType::EOF_FILE) {
+            eof_position = pulled;
+        }
+        return token;
+    }
+
+    const Token &TokenSource::peek(size_t ahead) {
+        while (pulled <= consumed + ahead) {
+            ring[pulled % ring.size()] = pull();
+            pulled++;
+        }
+        return ring[(consumed + ahead) % ring.size()];
+    }
+
+    const Token &TokenSource::advance() {
+        if (at_end()) {
+            throw std::out_of_range("Cannot advance past the end of tokens.");
+        }
+        peek();
+        return ring[consumed++ % ring.size()];
+    }
+
+    bool TokenSource::at_end() {
+        peek();
+        return eof_position && consumed > *eof_position;
+    }
+
+} // namespace minidb
@@ -0,0 +1,81 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "lexer.h"
+#include "token.h"
+
+namespace minidb {
+
+    /**
+     * @class TokenSource
+     * @brief The parser's view of the token stream: the current token, a little lookahead,
+     * and the token consumed last.
+     *
+     * Tokens are pulled from the lexer on demand into a fixed ring buffer, so parsing a
+     * script of any size holds only a handful of tokens at a time. A source can also be
+     * built from an already tokenized vector.
+     *
+     * Past the end of the stream peek() keeps returning an EOF_FILE token.
+     *
+     * @par Usage Example:
+     * @code
+     * Lexer lexer(script);
+     * TokenSource tokens(lexer);
+     * while (tokens.peek().type != TokenType::EOF_FILE) {
+     *     const Token &token = tokens.advance();
+     *     ...
+     * }
+     * @endcode
+     */
+    class TokenSource {
+    public:
+        // How far beyond the current token peek() can see.
+        static constexpr size_t LOOKAHEAD = 2;
+
+        /// @brief Pulls tokens lazily from a lexer, which must outlive the source.
+        explicit TokenSource(Lexer &lexer) : lexer(&lexer) {}
+
+        /// @brief Reads tokens from a vector. An EOF_FILE token is appended if it has none.
+        explicit TokenSource(std::vector<Token> tokens);
+
+        /**
+         * @brief The token `ahead` positions after the current one, without consuming it.
+         * @param ahead 0 for the current token, at most LOOKAHEAD.
+         */
+        const Token &peek(size_t ahead = 0);
+
+        /**
+         * @brief Consumes the current token.
+         * @return The consumed token, valid until the next call to advance().
+         * @throws std::out_of_range if the EOF_FILE token was already consumed.
+         */
+        const Token &advance();
+
+        /// @brief The token consumed last. Only valid after a call to advance().
+        const Token &previous() const { return ring[(consumed - 1) % ring.size()]; }
+
+        /// @brief True once the EOF_FILE token has been consumed.
+        bool at_end();
+
+    private:
+        Token pull();
+
+        // The previous token, the current one and LOOKAHEAD more, indexed by absolute position.
+        std::array<Token, LOOKAHEAD + 2> ring{};
+        size_t consumed = 0; // Tokens consumed so far; the current token is at this position
+        size_t pulled = 0;   // Tokens read from the lexer or vector so far
+        std::optional<size_t> eof_position;
+
+        Lexer *lexer = nullptr;
+        std::vector<Token> tokens; // Used when there is no lexer
+        size_t next_index = 0;
+    };
+
+} // namespace minidb
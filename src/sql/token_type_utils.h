@@ -2,58 +2,162 @@
 // Created by Amit Chavan on 7/14/25.
 //
 
-#include <string>
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 #include "token.h"
 #pragma once
 namespace minidb {
-    inline const std::unordered_map<std::string, TokenType>& keyword_map() {
-        static const std::unordered_map<std::string, TokenType> map = {
-                {"SELECT", TokenType::SELECT},
-                {"FROM", TokenType::FROM},
-                {"WHERE", TokenType::WHERE},
-                {"INSERT", TokenType::INSERT},
-                {"INTO", TokenType::INTO},
-                {"VALUES", TokenType::VALUES},
-                {"UPDATE", TokenType::UPDATE},
-                {"SET", TokenType::SET},
-                {"DELETE", TokenType::DELETE},
-                {"CREATE", TokenType::CREATE},
-                {"TABLE", TokenType::TABLE},
-                {"INDEX", TokenType::INDEX},
-                {"DROP", TokenType::DROP},
-                {"IF", TokenType::IF},
-                {"EXISTS", TokenType::EXISTS},
-                {"PRIMARY", TokenType::PRIMARY},
-                {"KEY", TokenType::KEY},
-
-                {"INT", TokenType::INT},
-                {"FLOAT", TokenType::FLOAT},
-                {"VARCHAR", TokenType::VARCHAR},
-                {"BOOL", TokenType::BOOL},
-                {"DATE", TokenType::DATE},
-                {"TIMESTAMP", TokenType::TIMESTAMP},
-                {"JOIN", TokenType::JOIN},
-                {"ON", TokenType::ON},
-                {"GROUP", TokenType::GROUP},
-                {"BY", TokenType::BY},
-                {"HAVING", TokenType::HAVING},
-                {"ORDER", TokenType::ORDER},
-                {"ASC", TokenType::ASC},
-                {"DESC", TokenType::DESC},
-
-                {"AND", TokenType::AND},
-                {"OR", TokenType::OR},
-                {"NOT", TokenType::NOT},
-                {"IS", TokenType::IS},
-                {"NULL", TokenType::NULL_LITERAL},
-                {"TRUE", TokenType::TRUE},
-                {"FALSE", TokenType::FALSE},
-
-                {"AS", TokenType::AS},
-                {"LIMIT", TokenType::LIMIT},
-                {"OFFSET", TokenType::OFFSET}
+
+    namespace keywords {
+
+        struct Keyword {
+            std::string_view text; // Upper case
+            TokenType type;
+        };
+
+        inline constexpr Keyword KEYWORDS[] = {
+            {"SELECT", TokenType::SELECT},
+            {"FROM", TokenType::FROM},
+            {"WHERE", TokenType::WHERE},
+            {"INSERT", TokenType::INSERT},
+            {"INTO", TokenType::INTO},
+            {"VALUES", TokenType::VALUES},
+            {"UPDATE", TokenType::UPDATE},
+            {"SET", TokenType::SET},
+            {"DELETE", TokenType::DELETE},
+            {"CREATE", TokenType::CREATE},
+            {"TABLE", TokenType::TABLE},
+            {"INDEX", TokenType::INDEX},
+            {"DROP", TokenType::DROP},
+            {"IF", TokenType::IF},
+            {"EXISTS", TokenType::EXISTS},
+            {"PRIMARY", TokenType::PRIMARY},
+            {"KEY", TokenType::KEY},
+            {"MATERIALIZED", TokenType::MATERIALIZED},
+            {"VIEW", TokenType::VIEW},
+            {"ANALYZE", TokenType::ANALYZE},
+            {"EXPLAIN", TokenType::EXPLAIN},
+            {"PREPARE", TokenType::PREPARE},
+            {"EXECUTE", TokenType::EXECUTE},
+            {"DEALLOCATE", TokenType::DEALLOCATE},
+
+            {"INT", TokenType::INT},
+            {"FLOAT", TokenType::FLOAT},
+            {"VARCHAR", TokenType::VARCHAR},
+            {"BOOL", TokenType::BOOL},
+            {"DATE", TokenType::DATE},
+            {"TIMESTAMP", TokenType::TIMESTAMP},
+            {"JOIN", TokenType::JOIN},
+            {"ON", TokenType::ON},
+            {"GROUP", TokenType::GROUP},
+            {"BY", TokenType::BY},
+            {"HAVING", TokenType::HAVING},
+            {"ORDER", TokenType::ORDER},
+            {"ASC", TokenType::ASC},
+            {"DESC", TokenType::DESC},
+
+            {"AND", TokenType::AND},
+            {"OR", TokenType::OR},
+            {"NOT", TokenType::NOT},
+            {"IS", TokenType::IS},
+            {"NULL", TokenType::NULL_LITERAL},
+            {"TRUE", TokenType::TRUE},
+            {"FALSE", TokenType::FALSE},
+
+            {"AS", TokenType::AS},
+            {"LIMIT", TokenType::LIMIT},
+            {"OFFSET", TokenType::OFFSET},
+        };
+
+        inline constexpr size_t MIN_LENGTH = 2;
+        inline constexpr size_t MAX_LENGTH = 12;
+        inline constexpr size_t TABLE_SIZE = 128;
+
+        // Upper-cases a letter. Other characters map to values no keyword letter has.
+        constexpr unsigned fold(char c) {
+            return static_cast<unsigned char>(c) & 0xDFu;
+        }
+
+        // Hash of a word of MIN_LENGTH..MAX_LENGTH characters, independent of letter case.
+        constexpr size_t hash(std::string_view word) {
+            return (fold(word[0]) * 62u + fold(word[1]) + fold(word.back()) * 7u + word.size() * 8u) % TABLE_SIZE;
+        }
+
+        // Slot -> index into KEYWORDS, or -1. Built at compile time.
+        struct Table {
+            int8_t slots[TABLE_SIZE];
+            bool collision_free;
         };
-        return map;
+
+        constexpr Table build_table() {
+            Table table{};
+            table.collision_free = true;
+            for (auto &slot : table.slots) slot = -1;
+            for (size_t i = 0; i < sizeof(KEYWORDS) / sizeof(KEYWORDS[0]); i++) {
+                const std::string_view text = KEYWORDS[i].text;
+                if (text.size() < MIN_LENGTH || text.size() > MAX_LENGTH || table.slots[hash(text)] != -1) {
+                    table.collision_free = false;
+                }
+                table.slots[hash(text)] = static_cast<int8_t>(i);
+            }
+            return table;
+        }
+
+        inline constexpr Table TABLE = build_table();
+        static_assert(TABLE.collision_free,
+                      "Two keywords share a hash slot (or one is too long): adjust keywords::hash()");
+
+    } // namespace keywords
+
+    /**
+     * @brief Keywords that only mean something in one statement and are identifiers everywhere else.
+     *
+     * MATERIALIZED and VIEW only matter right after CREATE; ANALYZE, EXPLAIN, PREPARE, EXECUTE
+     * and DEALLOCATE only at the start of a statement. Existing schemas may keep tables and
+     * columns with those names.
+     */
+    constexpr bool is_non_reserved_keyword(TokenType type) {
+        switch (type) {
+            case TokenType::MATERIALIZED:
+            case TokenType::VIEW:
+            case TokenType::ANALYZE:
+            case TokenType::EXPLAIN:
+            case TokenType::PREPARE:
+            case TokenType::EXECUTE:
+            case TokenType::DEALLOCATE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * @brief Case-insensitive keyword lookup that neither allocates nor copies the word.
+     *
+     * A perfect hash over the keyword set, checked at compile time, picks the single
+     * keyword the word could be; one comparison then confirms it.
+     *
+     * @return The keyword's token type, or nullopt for an identifier.
+     */
+    constexpr std::optional<TokenType> lookup_keyword(std::string_view word) {
+        if (word.size() < keywords::MIN_LENGTH || word.size() > keywords::MAX_LENGTH) {
+            return std::nullopt;
+        }
+        int8_t slot = keywords::TABLE.slots[keywords::hash(word)];
+        if (slot < 0) {
+            return std::nullopt;
+        }
+        const keywords::Keyword &keyword = keywords::KEYWORDS[slot];
+        if (keyword.text.size() != word.size()) {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < word.size(); i++) {
+            if (keywords::fold(word[i]) != static_cast<unsigned char>(keyword.text[i])) {
+                return std::nullopt;
+            }
+        }
+        return keyword.type;
     }
-}
\ No newline at end of file
+}
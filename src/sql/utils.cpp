@@ -3,19 +3,70 @@
 //
 
 #include "utils.h"
-#include <regex>
 
 namespace minidb {
 
+    namespace {
+
+        constexpr size_t DATE_LENGTH = 10;      // YYYY-MM-DD
+        constexpr size_t TIMESTAMP_LENGTH = 19; // YYYY-MM-DD HH:MM:SS
+
+        // Reads the digits s[pos, pos + count) as a number, or returns -1 if one is not a digit.
+        int read_digits(std::string_view s, size_t pos, size_t count) {
+            int value = 0;
+            for (size_t i = pos; i < pos + count; i++) {
+                unsigned digit = static_cast<unsigned char>(s[i]) - '0';
+                if (digit > 9) {
+                    return -1;
+                }
+                value = value * 10 + static_cast<int>(digit);
+            }
+            return value;
+        }
+
+        // Decodes the YYYY-MM-DD prefix of s, which has at least DATE_LENGTH characters.
+        bool decode_date_prefix(std::string_view s, SQLDate &date) {
+            if (s[4] != '-' || s[7] != '-') {
+                return false;
+            }
+            date.year = read_digits(s, 0, 4);
+            date.month = read_digits(s, 5, 2);
+            date.day = read_digits(s, 8, 2);
+            return date.year >= 0 && date.month >= 0 && date.day >= 0;
+        }
+
+    } // namespace
+
+    std::optional<SQLDate> decode_date_literal(std::string_view s) {
+        SQLDate date{};
+        if (s.size() != DATE_LENGTH || !decode_date_prefix(s, date)) {
+            return std::nullopt;
+        }
+        return date;
+    }
+
+    std::optional<SQLTimestamp> decode_timestamp_literal(std::string_view s) {
+        SQLDate date{};
+        if (s.size() != TIMESTAMP_LENGTH || !decode_date_prefix(s, date) || s[10] != ' ' || s[13] != ':'
+            || s[16] != ':') {
+            return std::nullopt;
+        }
+        SQLTimestamp timestamp{date.year, date.month, date.day, read_digits(s, 11, 2), read_digits(s, 14, 2),
+                               read_digits(s, 17, 2)};
+        if (timestamp.hour < 0 || timestamp.minute < 0 || timestamp.second < 0) {
+            return std::nullopt;
+        }
+        return timestamp;
+    }
+
     /**
      * @brief Checks if a given string matches the 'YYYY-MM-DD' date literal format.
      *
      * @param s The string to validate.
      * @return true if the string is a valid date literal, false otherwise.
      */
-    bool is_date_literal(const std::string& s) {
-        static const std::regex date_regex("\\d{4}-\\d{2}-\\d{2}");
-        return std::regex_match(s, date_regex);
+    bool is_date_literal(std::string_view s) {
+        return decode_date_literal(s).has_value();
     }
 
     /**
@@ -24,9 +75,20 @@ namespace minidb {
      * @param s The string to validate.
      * @return true if the string is a valid timestamp literal, false otherwise.
      */
-    bool is_timestamp_literal(const std::string& s) {
-        static const std::regex timestamp_regex("\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}");
-        return std::regex_match(s, timestamp_regex);
+    bool is_timestamp_literal(std::string_view s) {
+        return decode_timestamp_literal(s).has_value();
+    }
+
+    std::string unescape_string_literal(std::string_view text) {
+        std::string value;
+        value.reserve(text.size());
+        for (size_t i = 0; i < text.size(); i++) {
+            value += text[i];
+            if (text[i] == '\'' && i + 1 < text.size() && text[i + 1] == '\'') {
+                i++;
+            }
+        }
+        return value;
     }
 
 }
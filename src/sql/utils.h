@@ -4,11 +4,31 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
+#include <string_view>
+#include "literal_value.h"
 
 namespace minidb {
 
-    bool is_date_literal(const std::string& s);
-    bool is_timestamp_literal(const std::string& s);
+    bool is_date_literal(std::string_view s);
+    bool is_timestamp_literal(std::string_view s);
+
+    /**
+     * @brief Decodes 'YYYY-MM-DD' in one pass over the characters.
+     * @return The date, or nullopt if the text does not have exactly that shape.
+     */
+    std::optional<SQLDate> decode_date_literal(std::string_view s);
+
+    /**
+     * @brief Decodes 'YYYY-MM-DD HH:MM:SS' in one pass over the characters.
+     * @return The timestamp, or nullopt if the text does not have exactly that shape.
+     */
+    std::optional<SQLTimestamp> decode_timestamp_literal(std::string_view s);
+
+    /**
+     * @brief The value of a string literal token: its text with each '' collapsed to '.
+     */
+    std::string unescape_string_literal(std::string_view text);
 
 } // namespace minidb
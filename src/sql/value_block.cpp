@@ -0,0 +1,104 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+/**
+ * @file value_block.cpp
+ * @brief Column-wise storage of INSERT literal rows.
+ */
+
+#include "value_block.h"
+#include <stdexcept>
+#include <type_traits>
+
+namespace minidb {
+
+    namespace {
+
+        constexpr size_t GENERIC = std::variant_size_v<ColumnValues> - 1;
+
+        // Storage of the value's own type, with `size` placeholder slots.
+        ColumnValues typed_storage(const LiteralValue &value, size_t size) {
+            return std::visit([size](const auto &v) -> ColumnValues {
+                return std::vector<std::decay_t<decltype(v)>>(size);
+            }, value);
+        }
+
+        std::vector<LiteralValue> generic_storage(ColumnValues &values) {
+            return std::visit([](auto &typed) {
+                using T = typename std::decay_t<decltype(typed)>::value_type;
+                if constexpr (std::is_same_v<T, LiteralValue>) {
+                    return std::move(typed);
+                } else {
+                    std::vector<LiteralValue> generic;
+                    generic.reserve(typed.size());
+                    for (size_t row = 0; row < typed.size(); row++) {
+                        generic.emplace_back(std::in_place_type<T>, std::move(typed[row]));
+                    }
+                    return generic;
+                }
+            }, values);
+        }
+
+    } // namespace
+
+    LiteralValue ValueBlock::value(size_t row, size_t column) const {
+        return std::visit([row](const auto &values) -> LiteralValue {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+            return static_cast<T>(values[row]);
+        }, columns[column].values);
+    }
+
+    ValueBlock::Column &ValueBlock::next() {
+        if (rows == 0 && next_column == columns.size()) {
+            columns.emplace_back();
+        }
+        if (next_column == columns.size()) {
+            throw std::runtime_error("VALUES row " + std::to_string(rows + 1) + " has more than "
+                                     + std::to_string(columns.size()) + " values");
+        }
+        return columns[next_column++];
+    }
+
+    void ValueBlock::append(LiteralValue value) {
+        Column &column = next();
+        std::visit([](auto &values) { values.emplace_back(); }, column.values);
+        store(column, rows, std::move(value));
+    }
+
+    void ValueBlock::append_placeholder() {
+        std::visit([](auto &values) { values.emplace_back(); }, next().values);
+    }
+
+    void ValueBlock::end_row() {
+        if (next_column != columns.size()) {
+            throw std::runtime_error("VALUES row " + std::to_string(rows + 1) + " has "
+                                     + std::to_string(next_column) + " values, expected "
+                                     + std::to_string(columns.size()));
+        }
+        rows++;
+        next_column = 0;
+    }
+
+    void ValueBlock::set(size_t row, size_t column, LiteralValue value) {
+        store(columns[column], row, std::move(value));
+    }
+
+    void ValueBlock::store(Column &column, size_t row, LiteralValue value) {
+        if (!column.typed) {
+            column.values = typed_storage(value, std::visit([](const auto &v) { return v.size(); }, column.values));
+            column.typed = true;
+        } else if (column.values.index() != value.index() && column.values.index() != GENERIC) {
+            column.values = generic_storage(column.values);
+        }
+        std::visit([row, &value](auto &values) {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+            if constexpr (std::is_same_v<T, LiteralValue>) {
+                values[row] = std::move(value);
+            } else {
+                values[row] = std::get<T>(std::move(value));
+            }
+        }, column.values);
+    }
+
+} // namespace minidb
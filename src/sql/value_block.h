@@ -0,0 +1,96 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+#include "literal_value.h"
+
+namespace minidb {
+
+    /**
+     * @brief The values of one column of a ValueBlock, in rows order.
+     *
+     * A column whose literals all have the same type is stored as a vector of that type; the
+     * alternatives are in the same order as LiteralValue's. A column mixing types, or holding
+     * only parameter placeholders so far, is stored as std::vector<LiteralValue>.
+     */
+    using ColumnValues = std::variant<std::vector<int64_t>, std::vector<double>, std::vector<std::string>,
+                                      std::vector<bool>, std::vector<SQLDate>, std::vector<SQLTimestamp>,
+                                      std::vector<LiteralValue>>;
+
+    /**
+     * @class ValueBlock
+     * @brief The literal rows of an INSERT ... VALUES, stored column by column.
+     *
+     * The parser appends each row's values straight into typed column vectors, so a
+     * 10,000-row INSERT costs a few vector growths per column instead of one node per value,
+     * and the executor can read a whole column with std::get_if on column().
+     *
+     * A parameter placeholder takes a slot holding no meaningful value; the statement lists
+     * it in InsertStatementNode::parameters and binding fills it in with set().
+     *
+     * @par Usage Example:
+     * @code
+     * ValueBlock block;
+     * block.append(int64_t{1});
+     * block.append(std::string("ann"));
+     * block.end_row();
+     * if (auto *ids = std::get_if<std::vector<int64_t>>(&block.column(0))) { ... }
+     * @endcode
+     */
+    class ValueBlock {
+    public:
+        size_t row_count() const { return rows; }
+
+        size_t column_count() const { return columns.size(); }
+
+        /// @brief All values of a column, typed when the column's literals share one type.
+        const ColumnValues &column(size_t column) const { return columns[column].values; }
+
+        /// @brief A single value, unpacked into a LiteralValue.
+        LiteralValue value(size_t row, size_t column) const;
+
+        /// @brief Preallocates `count` columns, before the first row is appended.
+        void reserve_columns(size_t count) { columns.reserve(count); }
+
+        /**
+         * @brief Appends the next value of the row being built.
+         * @throws std::runtime_error if the row already has a value for every column.
+         */
+        void append(LiteralValue value);
+
+        /// @brief Appends a placeholder slot to the row being built.
+        void append_placeholder();
+
+        /**
+         * @brief Finishes the row being built. The first row fixes the number of columns.
+         * @throws std::runtime_error if the row has fewer values than there are columns.
+         */
+        void end_row();
+
+        /// @brief Replaces a value, typically a placeholder with its bound parameter.
+        void set(size_t row, size_t column, LiteralValue value);
+
+    private:
+        struct Column {
+            ColumnValues values{std::vector<LiteralValue>()};
+            bool typed = false; // Set by the first literal; placeholders alone do not type a column
+        };
+
+        Column &next();
+
+        // Stores `value` in the column, converting its storage first if the types differ.
+        static void store(Column &column, size_t row, LiteralValue value);
+
+        std::vector<Column> columns;
+        size_t rows = 0;
+        size_t next_column = 0; // Position in the row being built
+    };
+
+} // namespace minidb
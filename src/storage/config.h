@@ -26,5 +26,12 @@ static constexpr int INVALID_PAGE_ID = -1;
 static constexpr int HEADER_PAGE_ID = 0;
 static constexpr page_id_t FIRST_GAM_PAGE_ID = 1;
 
+/**
+ * @brief Number of rows the executor processes per batch.
+ *
+ * Selection vectors index into a batch, so this also bounds the row index range.
+ */
+static constexpr int BATCH_SIZE = 1024;
+
 
 
@@ -61,6 +61,35 @@ IOResult DiskManager::write_page(page_id_t page_id, const char* page_data) {
   return IOResult::SUCCESS;
 }
 
+IOResult DiskManager::write_pages(page_id_t first_page_id, const char* page_data, size_t count) {
+  if (!db_file_.is_open()) {
+	std::cerr << "Cannot write pages. Database file is not open." << std::endl;
+	return IOResult::FILE_NOT_OPEN;
+  }
+  if (count == 0) {
+	return IOResult::SUCCESS;
+  }
+
+  std::streampos offset = static_cast<std::streampos>(first_page_id) * PAGE_SIZE;
+  db_file_.seekp(offset, std::ios::beg);
+  if (db_file_.fail()) {
+	std::cerr << "Error seeking to page " << first_page_id << " for writing." << std::endl;
+	db_file_.clear();
+	return IOResult::SEEK_ERROR;
+  }
+
+  db_file_.write(page_data, static_cast<std::streamsize>(count * PAGE_SIZE));
+  if (db_file_.fail()) {
+	std::cerr << "Error writing " << count << " pages starting at page " << first_page_id << "." << std::endl;
+	db_file_.clear();
+	return IOResult::WRITE_ERROR;
+  }
+
+  // One flush for the whole run instead of one per page.
+  db_file_.flush();
+  return IOResult::SUCCESS;
+}
+
 IOResult DiskManager::read_page(page_id_t page_id, char* page_data) {
   if (!db_file_.is_open()) {
 	std::cerr << "Cannot read page. Database file is not open." << std::endl;
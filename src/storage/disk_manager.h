@@ -5,6 +5,7 @@
 #pragma once
 
 #include "config.h"
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include "error_codes.h"
@@ -31,6 +32,15 @@ class DiskManager {
    */
   IOResult write_page(page_id_t page_id, const char *data);
 
+  /**
+   * @brief Writes a run of consecutive pages with a single seek and a single flush.
+   * Used by batched writers (e.g. multi-row INSERT) that fill several pages at once.
+   * @param first_page_id  ID of the first page in the run.
+   * @param data  count * PAGE_SIZE bytes holding the pages back to back.
+   * @param count  Number of pages to write.
+   */
+  IOResult write_pages(page_id_t first_page_id, const char *data, size_t count);
+
   /**
    * @brief Reads the content of specified page in the accompanying buffer
    * @param page_id ID of the page that is being written.
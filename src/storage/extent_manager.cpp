@@ -5,14 +5,42 @@
 #include "storage_def.h"
 
 #include "extent_manager.h"
+#include <cstring>
 
 
 page_id_t ExtentManager::allocate_extent() {
 
 }
 
-void ExtentManager::deallocate_extent(page_id_t start_page_id) {
+IOResult ExtentManager::deallocate_extent(page_id_t start_page_id) {
+  return deallocate_extents({start_page_id});
+}
+
+IOResult ExtentManager::deallocate_extents(const std::vector<page_id_t> &start_page_ids) {
+  if (start_page_ids.empty()) {
+	return IOResult::SUCCESS;
+  }
+  std::lock_guard<std::mutex> guard(lock);
+
+  // A GAM bit is set while its extent is allocated.
+  char gam_page_buffer[PAGE_SIZE];
+  IOResult result = disk_manager->read_page(FIRST_GAM_PAGE_ID, gam_page_buffer);
+  if (result != IOResult::SUCCESS) {
+	return result;
+  }
+  auto gam_page = reinterpret_cast<BitmapPage *>(gam_page_buffer);
+  Bitmap gam(gam_page->bitmap, sizeof(gam_page->bitmap) * 8);
 
+  for (page_id_t start_page_id : start_page_ids) {
+	if (start_page_id < 0 || start_page_id % EXTENT_SIZE != 0
+		|| static_cast<size_t>(start_page_id / EXTENT_SIZE) >= gam.get_size_in_bits()) {
+	  return IOResult::INVALID_PAGE;
+	}
+  }
+  for (page_id_t start_page_id : start_page_ids) {
+	gam.clear(start_page_id / EXTENT_SIZE);
+  }
+  return disk_manager->write_page(FIRST_GAM_PAGE_ID, gam_page_buffer);
 }
 
 void ExtentManager::initialize_new_db() {
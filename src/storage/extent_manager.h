@@ -5,6 +5,8 @@
 #pragma once
 
 #include "disk_manager.h"
+#include <mutex>
+#include <vector>
 
 /**
  * @class ExtentManager
@@ -14,11 +16,24 @@
  * Can read more about them here - https://tinyurl.com/32rhava7
  */
 class ExtentManager {
+ public:
   explicit ExtentManager(DiskManager* disk_manager);
 
   page_id_t allocate_extent();
 
-  void deallocate_extent(page_id_t start_page_id);
+  /**
+   * @brief Returns one extent to the GAM.
+   * @return The result of deallocate_extents() for that extent.
+   */
+  IOResult deallocate_extent(page_id_t start_page_id);
+
+  /**
+   * @brief Returns several extents to the GAM with a single read and write of the GAM page.
+   * Used by bulk deletes, which can empty many extents at once.
+   * @param start_page_ids First page of every extent to free.
+   * @return INVALID_PAGE if an id is not the start of an extent covered by the GAM page.
+   */
+  IOResult deallocate_extents(const std::vector<page_id_t> &start_page_ids);
  private:
   /**
    * @brief Initializes a brand new database file.
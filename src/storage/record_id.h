@@ -0,0 +1,28 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include "config.h"
+#include <cstdint>
+
+/**
+ * @struct RecordId
+ * @brief Physical address of a row: the page it lives on and its slot within that page.
+ *
+ * The executor carries record ids instead of decoded rows so that columns can be
+ * fetched lazily, only for the rows that survive filtering.
+ */
+struct RecordId {
+  page_id_t page_id = INVALID_PAGE_ID;
+  uint16_t slot = 0;
+
+  bool operator==(const RecordId &other) const {
+	return page_id == other.page_id && slot == other.slot;
+  }
+
+  bool operator!=(const RecordId &other) const {
+	return !(*this == other);
+  }
+};
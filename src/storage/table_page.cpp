@@ -0,0 +1,277 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "table_page.h"
+#include <algorithm>
+#include <cstring>
+
+void TablePage::init() {
+  std::memset(data, 0, PAGE_SIZE);
+  TablePageHeader *page_header = header();
+  page_header->page_type = PageType::Data;
+  page_header->next_page_id = INVALID_PAGE_ID;
+  page_header->slot_count = 0;
+  page_header->free_space_offset = PAGE_SIZE;
+  page_header->free_slot_count = 0;
+}
+
+size_t TablePage::free_space() const {
+  const TablePageHeader *page_header = header();
+  size_t new_slots = page_header->free_slot_count > 0 ? 0 : 1;
+  size_t directory_end = sizeof(TablePageHeader) + (page_header->slot_count + new_slots) * sizeof(Slot);
+  if (directory_end > page_header->free_space_offset) {
+	return 0;
+  }
+  return page_header->free_space_offset - directory_end;
+}
+
+std::optional<uint16_t> TablePage::insert_record(std::string_view record) {
+  uint16_t slot = 0;
+  if (insert_run(&record, 1, nullptr, &slot) == 0) {
+	return std::nullopt;
+  }
+  return slot;
+}
+
+size_t TablePage::insert_records(const std::vector<std::string_view> &records, size_t first,
+								 std::vector<uint16_t> *inserted_slots) {
+  if (first >= records.size()) {
+	return 0;
+  }
+  return insert_run(records.data() + first, records.size() - first, inserted_slots, nullptr);
+}
+
+size_t TablePage::insert_run(const std::string_view *records, size_t count, std::vector<uint16_t> *inserted_slots,
+							 uint16_t *last_slot) {
+  TablePageHeader *page_header = header();
+  Slot *directory = slots();
+  size_t slot_count = page_header->slot_count;
+  size_t free_offset = page_header->free_space_offset;
+  // Free slots are taken lowest number first. Slots before the cursor have been looked at.
+  size_t free_cursor = 0;
+
+  size_t i = 0;
+  for (; i < count; i++) {
+	size_t length = records[i].size();
+	size_t slot = next_free_slot(free_cursor, slot_count);
+	size_t new_slot_bytes = slot == slot_count ? sizeof(Slot) : 0;
+	size_t directory_end = sizeof(TablePageHeader) + slot_count * sizeof(Slot);
+	if (directory_end + new_slot_bytes + length > free_offset) {
+	  page_header->slot_count = static_cast<uint16_t>(slot_count);
+	  page_header->free_space_offset = static_cast<uint16_t>(free_offset);
+	  if (!reclaim_space(new_slot_bytes + length)) {
+		break;
+	  }
+	  slot_count = page_header->slot_count;
+	  free_offset = page_header->free_space_offset;
+	  // Compaction may have dropped the chosen slot from the end of the directory. If so, the
+	  // directory shrank by at least that slot, so appending one still fits.
+	  slot = next_free_slot(slot, slot_count);
+	}
+	free_offset -= length;
+	std::memcpy(data + free_offset, records[i].data(), length);
+	directory[slot].offset = static_cast<uint16_t>(free_offset);
+	directory[slot].length = static_cast<uint16_t>(length);
+	directory[slot].capacity = static_cast<uint16_t>(length);
+	directory[slot].state = SlotState::Normal;
+	if (slot == slot_count) {
+	  slot_count++;
+	} else {
+	  page_header->free_slot_count--;
+	}
+	free_cursor = slot + 1;
+	if (inserted_slots != nullptr) {
+	  inserted_slots->push_back(static_cast<uint16_t>(slot));
+	}
+	if (last_slot != nullptr) {
+	  *last_slot = static_cast<uint16_t>(slot);
+	}
+  }
+
+  page_header->slot_count = static_cast<uint16_t>(slot_count);
+  page_header->free_space_offset = static_cast<uint16_t>(free_offset);
+  return i;
+}
+
+size_t TablePage::next_free_slot(size_t from, size_t slot_count) const {
+  if (header()->free_slot_count == 0) {
+	return slot_count;
+  }
+  const Slot *directory = slots();
+  while (from < slot_count && directory[from].state != SlotState::Free) {
+	from++;
+  }
+  return std::min(from, slot_count);
+}
+
+UpdateResult TablePage::update_record(uint16_t slot, std::string_view record) {
+  TablePageHeader *page_header = header();
+  Slot *directory = slots();
+  if (slot >= page_header->slot_count) {
+	return UpdateResult::InvalidSlot;
+  }
+  Slot &root = directory[slot];
+  if (root.state != SlotState::Normal && root.state != SlotState::Redirect) {
+	return UpdateResult::InvalidSlot;
+  }
+
+  uint16_t current = root.state == SlotState::Redirect ? root.offset : slot;
+  if (record.size() <= directory[current].capacity) {
+	std::memcpy(data + directory[current].offset, record.data(), record.size());
+	directory[current].length = static_cast<uint16_t>(record.size());
+	return UpdateResult::InPlace;
+  }
+
+  // The record outgrew its space: write it to a heap-only slot and point the root at it.
+  // Nothing outside the page refers to a heap-only version, so the one being replaced is
+  // free right away and the new version may take its slot.
+  if (current != slot) {
+	directory[current].state = SlotState::Free;
+	page_header->free_slot_count++;
+  }
+  size_t version = next_free_slot(0, page_header->slot_count);
+  size_t new_slot_bytes = version == page_header->slot_count ? sizeof(Slot) : 0;
+  size_t directory_end = sizeof(TablePageHeader) + page_header->slot_count * sizeof(Slot);
+  if (directory_end + new_slot_bytes + record.size() > page_header->free_space_offset) {
+	if (!reclaim_space(new_slot_bytes + record.size())) {
+	  if (current != slot) {
+		directory[current].state = SlotState::HeapOnly;
+		page_header->free_slot_count--;
+	  }
+	  return UpdateResult::NoSpace;
+	}
+	// Compaction may have dropped the chosen slot from the end of the directory.
+	version = next_free_slot(version, page_header->slot_count);
+  }
+  if (version == page_header->slot_count) {
+	page_header->slot_count++;
+  } else {
+	page_header->free_slot_count--;
+  }
+  page_header->free_space_offset -= static_cast<uint16_t>(record.size());
+  directory[version].offset = page_header->free_space_offset;
+  write_record(static_cast<uint16_t>(version), record, SlotState::HeapOnly);
+
+  root.state = SlotState::Redirect;
+  root.offset = version;
+  root.length = 0;
+  root.capacity = 0;
+  return UpdateResult::HeapOnly;
+}
+
+size_t TablePage::delete_records(const std::vector<uint16_t> &slots_to_delete, std::vector<uint16_t> *deleted_slots) {
+  Slot *directory = slots();
+  uint16_t slot_count = header()->slot_count;
+  size_t deleted = 0;
+  for (uint16_t slot : slots_to_delete) {
+	if (slot >= slot_count) {
+	  continue;
+	}
+	Slot &root = directory[slot];
+	if (root.state == SlotState::Redirect) {
+	  // Only the root is addressable from outside the page; its heap-only version can go now.
+	  directory[root.offset].state = SlotState::Free;
+	  header()->free_slot_count++;
+	} else if (root.state != SlotState::Normal) {
+	  continue;
+	}
+	root.state = SlotState::Dead;
+	root.length = 0;
+	root.capacity = 0;
+	if (deleted_slots != nullptr) {
+	  deleted_slots->push_back(slot);
+	}
+	deleted++;
+  }
+  return deleted;
+}
+
+size_t TablePage::reclaim_slots(const std::vector<uint16_t> &slots_to_reclaim) {
+  TablePageHeader *page_header = header();
+  Slot *directory = slots();
+  size_t reclaimed = 0;
+  for (uint16_t slot : slots_to_reclaim) {
+	if (slot < page_header->slot_count && directory[slot].state == SlotState::Dead) {
+	  directory[slot].state = SlotState::Free;
+	  reclaimed++;
+	}
+  }
+  page_header->free_slot_count = static_cast<uint16_t>(page_header->free_slot_count + reclaimed);
+  return reclaimed;
+}
+
+bool TablePage::is_empty() const {
+  const Slot *directory = slots();
+  for (uint16_t slot = 0; slot < header()->slot_count; slot++) {
+	if (directory[slot].state != SlotState::Dead && directory[slot].state != SlotState::Free) {
+	  return false;
+	}
+  }
+  return true;
+}
+
+void TablePage::compact() {
+  TablePageHeader *page_header = header();
+  Slot *directory = slots();
+  char compacted[PAGE_SIZE];
+  size_t free_offset = PAGE_SIZE;
+  for (uint16_t slot = 0; slot < page_header->slot_count; slot++) {
+	Slot &entry = directory[slot];
+	if (entry.state != SlotState::Normal && entry.state != SlotState::HeapOnly) {
+	  continue;
+	}
+	// Space a shrunken record no longer uses is given back here.
+	free_offset -= entry.length;
+	std::memcpy(compacted + free_offset, data + entry.offset, entry.length);
+	entry.offset = static_cast<uint16_t>(free_offset);
+	entry.capacity = entry.length;
+  }
+  std::memcpy(data + free_offset, compacted + free_offset, PAGE_SIZE - free_offset);
+  page_header->free_space_offset = static_cast<uint16_t>(free_offset);
+  // Dead slots stay in the directory: an index may still hold their RecordId, so their
+  // numbers must not be handed to new records. Free slots at the end can go.
+  while (page_header->slot_count > 0 && directory[page_header->slot_count - 1].state == SlotState::Free) {
+	page_header->slot_count--;
+	page_header->free_slot_count--;
+  }
+}
+
+bool TablePage::reclaim_space(size_t needed) {
+  const TablePageHeader *page_header = header();
+  const Slot *directory = slots();
+  size_t live_bytes = 0;
+  for (uint16_t slot = 0; slot < page_header->slot_count; slot++) {
+	if (directory[slot].state == SlotState::Normal || directory[slot].state == SlotState::HeapOnly) {
+	  live_bytes += directory[slot].length;
+	}
+  }
+  size_t directory_end = sizeof(TablePageHeader) + page_header->slot_count * sizeof(Slot);
+  if (directory_end + needed > PAGE_SIZE - live_bytes) {
+	return false;
+  }
+  compact();
+  return true;
+}
+
+void TablePage::write_record(uint16_t slot, std::string_view record, SlotState state) {
+  Slot &entry = slots()[slot];
+  std::memcpy(data + entry.offset, record.data(), record.size());
+  entry.length = static_cast<uint16_t>(record.size());
+  entry.capacity = entry.length;
+  entry.state = state;
+}
+
+std::optional<std::string_view> TablePage::get_record(uint16_t slot) const {
+  if (slot >= header()->slot_count) {
+	return std::nullopt;
+  }
+  const Slot *entry = &slots()[slot];
+  if (entry->state == SlotState::Redirect) {
+	entry = &slots()[entry->offset];
+  }
+  if (entry->state == SlotState::Dead || entry->state == SlotState::Free) {
+	return std::nullopt;
+  }
+  return std::string_view(data + entry->offset, entry->length);
+}
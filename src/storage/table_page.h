@@ -0,0 +1,216 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include "config.h"
+#include "storage_def.h"
+
+/**
+ * @enum SlotState
+ * @brief State of a slot directory entry.
+ */
+enum class SlotState : uint8_t {
+  // Holds a record addressed from outside the page (by a RecordId in an index or a scan).
+  Normal,
+  // The record was updated onto another slot of the page. `offset` holds that slot.
+  Redirect,
+  // A newer version of a record, reachable only through its Redirect slot.
+  HeapOnly,
+  // Deleted. The number stays reserved while an index may still hold its RecordId.
+  Dead,
+  // Deleted and no longer referenced from anywhere; the next insert may take the number.
+  Free
+};
+
+/**
+ * @enum UpdateResult
+ * @brief Where TablePage::update_record() put the new version of a record.
+ */
+enum class UpdateResult {
+  // Overwrote the old version; the record did not grow.
+  InPlace,
+  // Stored on the same page behind a redirect; the RecordId is unchanged.
+  HeapOnly,
+  // The page has no room. The caller must move the record to another page.
+  NoSpace,
+  // The slot does not hold a record.
+  InvalidSlot
+};
+
+#pragma pack(1)
+
+/**
+ * @struct TablePageHeader
+ * @brief Fixed header at the start of every data page.
+ */
+struct TablePageHeader {
+  PageType page_type;
+  // Data pages of a table are chained together.
+  page_id_t next_page_id;
+  // Number of entries in the slot directory, including deleted ones.
+  uint16_t slot_count;
+  // Offset where record data begins. Records grow down from the end of the page.
+  uint16_t free_space_offset;
+  // Number of Free entries in the slot directory.
+  uint16_t free_slot_count;
+};
+
+/**
+ * @struct Slot
+ * @brief Slot directory entry locating one record inside the page.
+ */
+struct Slot {
+  uint16_t offset;
+  uint16_t length;
+  // Bytes reserved for the record at `offset`. An in-place update that shrinks the record
+  // lowers `length` but keeps the space, so a later update can grow back into it.
+  uint16_t capacity;
+  SlotState state;
+};
+#pragma pack()
+
+/**
+ * @class TablePage
+ * @brief A helper class to manipulate a slotted data page held in a raw page buffer.
+ *
+ * Layout: header, then the slot directory growing forward, then free space, then record
+ * data growing backward from the end of the page. A record is addressed by its slot
+ * number, which stays stable for the lifetime of the record.
+ *
+ * Updates keep the slot number stable too (heap-only tuples). A record that fits in the
+ * space it was given is overwritten in place. A record that grows is written to a new HeapOnly slot on the
+ * same page and its original slot becomes a Redirect to it. A redirect always points at
+ * the newest version, so the forwarding chain is at most one hop. Indexes keep pointing
+ * at the original slot and need no maintenance unless an indexed column changed. A
+ * replaced or deleted heap-only version is never addressed from outside the page, so its
+ * slot becomes Free at once.
+ *
+ * Deletes only mark slots dead. Their space is reclaimed lazily by compacting the page the
+ * first time an insert or update does not fit otherwise. A dead slot keeps its number until
+ * the caller has removed its index entries and calls reclaim_slots(), so a RecordId left
+ * behind in an index never resolves to a different record. Only then is the slot Free:
+ * inserts reuse Free slots before growing the directory, and compaction drops Free slots
+ * at the end of the directory.
+ */
+class TablePage {
+ public:
+  /**
+   * @brief Constructs a TablePage wrapper around a page buffer of PAGE_SIZE bytes.
+   */
+  explicit TablePage(char *data) : data(data) {}
+
+  /**
+   * @brief Formats the buffer as an empty data page.
+   */
+  void init();
+
+  /**
+   * @brief Inserts a single record.
+   * @return The slot of the new record, or nullopt if the page has no room for it.
+   */
+  std::optional<uint16_t> insert_record(std::string_view record);
+
+  /**
+   * @brief Inserts records[first], records[first + 1], ... until the page is full.
+   *
+   * Free space and the header are computed and written once for the whole run, so a
+   * multi-row INSERT touches each target page once instead of once per row.
+   *
+   * @param records The rows of the statement, already serialized.
+   * @param first Index of the first record to insert.
+   * @param slots If not null, receives the slot of every inserted record.
+   * @return The number of records inserted. 0 means the next record does not fit.
+   */
+  size_t insert_records(const std::vector<std::string_view> &records, size_t first,
+						std::vector<uint16_t> *slots = nullptr);
+
+  /**
+   * @brief Replaces a record, keeping it on this page under the same slot if possible.
+   * @param slot Slot of the record as known to indexes (never a HeapOnly slot).
+   * @param record The new version of the record.
+   */
+  UpdateResult update_record(uint16_t slot, std::string_view record);
+
+  /**
+   * @brief Marks a set of records dead in one pass over the page.
+   *
+   * Only the slot directory is touched; the space the records used is reclaimed later by
+   * compact(), when an insert or update on this page needs it.
+   *
+   * @param slots Slots of the records as known to indexes.
+   * @param deleted If not null, receives the slots that held a live record.
+   * @return The number of records deleted. Slots that are already dead are ignored.
+   */
+  size_t delete_records(const std::vector<uint16_t> &slots, std::vector<uint16_t> *deleted = nullptr);
+
+  /**
+   * @brief Makes dead slots available to new records.
+   *
+   * Call once nothing refers to the slots any more, typically right after their index
+   * entries were removed.
+   *
+   * @param slots Slots reported deleted by delete_records(). Slots that are not dead are ignored.
+   * @return The number of slots freed.
+   */
+  size_t reclaim_slots(const std::vector<uint16_t> &slots);
+
+  /**
+   * @brief Moves the live records together at the end of the page, reclaiming the space of
+   * dead records and shrunken updates. Slot numbers do not change. Dead slots stay in the
+   * directory; Free slots at its end are dropped.
+   */
+  void compact();
+
+  /**
+   * @brief True if no slot holds a live record.
+   */
+  bool is_empty() const;
+
+  /**
+   * @brief Returns the record stored in a slot, following a redirect to its newest version.
+   * @return nullopt if the slot does not exist or is dead.
+   */
+  std::optional<std::string_view> get_record(uint16_t slot) const;
+
+  SlotState get_slot_state(uint16_t slot) const { return slots()[slot].state; }
+
+  /**
+   * @brief Bytes available for one more record, after accounting for its slot.
+   */
+  size_t free_space() const;
+
+  PageType get_page_type() const { return header()->page_type; }
+
+  uint16_t get_slot_count() const { return header()->slot_count; }
+
+  page_id_t get_next_page_id() const { return header()->next_page_id; }
+
+  void set_next_page_id(page_id_t page_id) { header()->next_page_id = page_id; }
+
+ private:
+  TablePageHeader *header() const { return reinterpret_cast<TablePageHeader *>(data); }
+
+  Slot *slots() const { return reinterpret_cast<Slot *>(data + sizeof(TablePageHeader)); }
+
+  void write_record(uint16_t slot, std::string_view record, SlotState state);
+
+  // Inserts records[0..count) until the page is full. Shared by the single-row and batch paths so
+  // neither has to build temporary containers per row. `last_slot` receives the slot of the last record.
+  size_t insert_run(const std::string_view *records, size_t count, std::vector<uint16_t> *inserted_slots,
+					uint16_t *last_slot);
+
+  // The first Free slot at or after `from`, or `slot_count` if there is none.
+  size_t next_free_slot(size_t from, size_t slot_count) const;
+
+  // Compacts the page if that would leave at least `needed` contiguous free bytes.
+  bool reclaim_space(size_t needed);
+
+  char *data;
+};
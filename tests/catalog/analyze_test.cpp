@@ -0,0 +1,107 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "catalog/analyze.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <string>
+#include "storage/table_page.h"
+
+using namespace minidb;
+
+TEST(ChooseSamplePagesTest, DistinctSortedAndRepeatable) {
+    auto pages = choose_sample_pages(1'000'000, 500, 7);
+    ASSERT_EQ(pages.size(), 500u);
+    EXPECT_TRUE(std::is_sorted(pages.begin(), pages.end()));
+    EXPECT_EQ(std::set<size_t>(pages.begin(), pages.end()).size(), 500u);
+    EXPECT_LT(pages.back(), 1'000'000u);
+    EXPECT_EQ(pages, choose_sample_pages(1'000'000, 500, 7));
+
+    EXPECT_EQ(choose_sample_pages(3, 10, 0), (std::vector<size_t>{0, 1, 2}));
+}
+
+class AnalyzeTest : public ::testing::Test {
+protected:
+    static constexpr page_id_t PAGES = 200;
+    static constexpr int ROWS_PER_PAGE = 50;
+
+    void SetUp() override {
+        std::filesystem::remove(db_file);
+        disk = std::make_unique<DiskManager>(db_file);
+
+        // Rows are "id,region" with region NULL on every fourth row.
+        char buffer[PAGE_SIZE];
+        for (page_id_t page_id = 0; page_id < PAGES; page_id++) {
+            TablePage page(buffer);
+            page.init();
+            for (int row = 0; row < ROWS_PER_PAGE; row++) {
+                int id = page_id * ROWS_PER_PAGE + row;
+                std::string region = id % 4 == 0 ? "" : "r" + std::to_string(id % 3);
+                page.insert_record(std::to_string(id) + "," + region);
+            }
+            // One deleted row and one updated row per page.
+            page.delete_records({0});
+            page.update_record(1, std::to_string(page_id * ROWS_PER_PAGE + 1) + ",r1-updated-region");
+            ASSERT_EQ(disk->write_page(page_id, buffer), IOResult::SUCCESS);
+            table_pages.push_back(page_id);
+        }
+    }
+
+    void TearDown() override {
+        disk.reset();
+        std::filesystem::remove(db_file);
+    }
+
+    static std::vector<std::optional<LiteralValue>> decode(std::string_view record) {
+        size_t comma = record.find(',');
+        std::vector<std::optional<LiteralValue>> values;
+        values.emplace_back(LiteralValue{static_cast<int64_t>(std::stoll(std::string(record.substr(0, comma))))});
+        std::string region(record.substr(comma + 1));
+        if (region.empty()) {
+            values.emplace_back(std::nullopt);
+        } else {
+            values.emplace_back(LiteralValue{region});
+        }
+        return values;
+    }
+
+    const std::string db_file = "analyze_test.db";
+    std::unique_ptr<DiskManager> disk;
+    std::vector<page_id_t> table_pages;
+};
+
+TEST_F(AnalyzeTest, SamplesPagesAndEstimatesRows) {
+    AnalyzeOptions options;
+    options.sample_pages = 40;
+    AnalyzeResult result = analyze_table(*disk, table_pages, 2, decode, options);
+
+    EXPECT_EQ(result.pages_read, 40u);
+    // Dead and heap-only slots are not rows.
+    EXPECT_DOUBLE_EQ(result.row_count, PAGES * (ROWS_PER_PAGE - 1));
+    ASSERT_EQ(result.columns.size(), 2u);
+
+    const ColumnStatistics &id = result.columns[0];
+    EXPECT_DOUBLE_EQ(id.null_fraction, 0.0);
+    EXPECT_GT(id.distinct_count, 0.3 * result.row_count);
+    EXPECT_NEAR(id.less_than_selectivity(LiteralValue{int64_t{PAGES * ROWS_PER_PAGE / 2}}), 0.5, 0.15);
+
+    const ColumnStatistics &region = result.columns[1];
+    EXPECT_NEAR(region.null_fraction, 0.25, 0.02);
+    EXPECT_NEAR(region.distinct_count, 4, 0.5);
+}
+
+TEST_F(AnalyzeTest, ReadsEveryPageOfSmallTables) {
+    AnalyzeResult result = analyze_table(*disk, table_pages, 2, decode);
+    EXPECT_EQ(result.pages_read, PAGES);
+    EXPECT_NEAR(result.columns[0].distinct_count, PAGES * (ROWS_PER_PAGE - 1), 0.03 * PAGES * ROWS_PER_PAGE);
+}
+
+TEST_F(AnalyzeTest, UnreadablePageThrows) {
+    std::vector<page_id_t> pages{0, 1'000'000};
+    EXPECT_THROW(analyze_table(*disk, pages, 2, decode), std::runtime_error);
+}
@@ -0,0 +1,86 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "catalog/column_statistics.h"
+
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace minidb;
+
+TEST(HyperLogLogTest, EstimatesWithinFewPercent) {
+    for (int64_t distinct : {100, 10'000, 1'000'000}) {
+        HyperLogLog sketch;
+        for (int64_t i = 0; i < distinct; i++) {
+            sketch.add(LiteralValue{i});
+            sketch.add(LiteralValue{i}); // Duplicates do not count.
+        }
+        EXPECT_NEAR(sketch.estimate(), static_cast<double>(distinct), 0.05 * static_cast<double>(distinct));
+    }
+}
+
+TEST(HyperLogLogTest, MergeEqualsUnion) {
+    HyperLogLog low, high, both;
+    for (int64_t i = 0; i < 50'000; i++) {
+        (i < 30'000 ? low : high).add(LiteralValue{i});
+        both.add(LiteralValue{i});
+    }
+    low.merge(high);
+    EXPECT_DOUBLE_EQ(low.estimate(), both.estimate());
+}
+
+TEST(ColumnStatisticsTest, NullFractionAndMostCommonValues) {
+    ColumnStatisticsBuilder builder;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 10 == 0) {
+            builder.add(std::nullopt);
+        } else if (i % 2 == 0) {
+            builder.add(LiteralValue{std::string("pending")});
+        } else {
+            builder.add(LiteralValue{"customer" + std::to_string(i)});
+        }
+    }
+    ColumnStatistics statistics = builder.build(1000);
+
+    EXPECT_DOUBLE_EQ(statistics.null_fraction, 0.1);
+    ASSERT_EQ(statistics.most_common_values.size(), 1u);
+    EXPECT_EQ(std::get<std::string>(statistics.most_common_values[0].first), "pending");
+    EXPECT_DOUBLE_EQ(statistics.most_common_values[0].second, 0.4);
+    EXPECT_DOUBLE_EQ(statistics.equal_selectivity(LiteralValue{std::string("pending")}), 0.4);
+    EXPECT_NEAR(statistics.distinct_count, 501, 10);
+    // The other 50% of rows are spread over ~500 values.
+    EXPECT_NEAR(statistics.equal_selectivity(LiteralValue{std::string("customer1")}), 0.001, 0.0002);
+}
+
+TEST(ColumnStatisticsTest, HistogramEstimatesRanges) {
+    ColumnStatisticsBuilder builder(1000);
+    for (int64_t i = 0; i < 100'000; i++) {
+        builder.add(LiteralValue{i});
+    }
+    ColumnStatistics statistics = builder.build(100'000, 10);
+
+    EXPECT_EQ(statistics.histogram_bounds.size(), 11u);
+    EXPECT_TRUE(statistics.most_common_values.empty());
+    EXPECT_NEAR(statistics.less_than_selectivity(LiteralValue{int64_t{25'000}}), 0.25, 0.05);
+    EXPECT_NEAR(statistics.less_than_selectivity(LiteralValue{int64_t{90'000}}), 0.9, 0.05);
+    EXPECT_DOUBLE_EQ(statistics.less_than_selectivity(LiteralValue{int64_t{-1}}), 0.0);
+    EXPECT_DOUBLE_EQ(statistics.less_than_selectivity(LiteralValue{int64_t{200'000}}), 1.0);
+}
+
+TEST(ColumnStatisticsTest, ScalesDistinctCountFromSample) {
+    // A 10% sample of a unique column: nearly every sampled value is a singleton.
+    ColumnStatisticsBuilder unique_column;
+    for (int64_t i = 0; i < 100'000; i += 10) {
+        unique_column.add(LiteralValue{i});
+    }
+    EXPECT_NEAR(unique_column.build(100'000).distinct_count, 100'000, 70'000);
+    EXPECT_GT(unique_column.build(100'000).distinct_count, 30'000);
+
+    // A 10% sample of a low-cardinality column: every value was seen, so no scaling.
+    ColumnStatisticsBuilder status_column;
+    for (int64_t i = 0; i < 10'000; i++) {
+        status_column.add(LiteralValue{i % 5});
+    }
+    EXPECT_NEAR(status_column.build(100'000).distinct_count, 5, 0.5);
+}
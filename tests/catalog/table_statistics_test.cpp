@@ -0,0 +1,136 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "catalog/table_statistics.h"
+
+#include <gtest/gtest.h>
+
+using namespace minidb;
+
+class TableStatisticsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        catalog.register_table("orders", {"id"});
+    }
+
+    void insert(StatisticsDelta &delta, int64_t id) {
+        delta.add_rows("orders", 1);
+        delta.insert_value("orders", "id", id);
+    }
+
+    void remove(StatisticsDelta &delta, int64_t id) {
+        delta.remove_rows("orders", 1);
+        delta.delete_value("orders", "id", id);
+    }
+
+    StatisticsCatalog catalog;
+};
+
+TEST_F(TableStatisticsTest, NewTableIsEmpty) {
+    auto statistics = catalog.get("orders");
+    ASSERT_TRUE(statistics.has_value());
+    EXPECT_EQ(statistics->row_count, 0u);
+    ASSERT_NE(statistics->bounds("ID"), nullptr);
+    EXPECT_FALSE(statistics->bounds("id")->min.has_value());
+    EXPECT_EQ(statistics->bounds("total"), nullptr);
+    EXPECT_FALSE(catalog.get("missing").has_value());
+}
+
+TEST_F(TableStatisticsTest, ChangesAreInvisibleUntilCommit) {
+    StatisticsDelta delta;
+    for (int64_t id : {5, 2, 9}) {
+        insert(delta, id);
+    }
+    EXPECT_EQ(catalog.get("orders")->row_count, 0u);
+
+    catalog.commit(delta);
+    auto statistics = catalog.get("ORDERS");
+    EXPECT_EQ(statistics->row_count, 3u);
+    EXPECT_EQ(std::get<int64_t>(*statistics->bounds("id")->min), 2);
+    EXPECT_EQ(std::get<int64_t>(*statistics->bounds("id")->max), 9);
+    EXPECT_TRUE(statistics->bounds("id")->min_exact);
+}
+
+TEST_F(TableStatisticsTest, AbortedTransactionLeavesNoTrace) {
+    {
+        StatisticsDelta aborted;
+        insert(aborted, 1);
+    }
+    EXPECT_EQ(catalog.get("orders")->row_count, 0u);
+}
+
+TEST_F(TableStatisticsTest, DeletingABoundMakesItInexact) {
+    StatisticsDelta load;
+    for (int64_t id : {1, 2, 3, 4}) {
+        insert(load, id);
+    }
+    catalog.commit(load);
+
+    StatisticsDelta delete_middle;
+    remove(delete_middle, 2);
+    catalog.commit(delete_middle);
+    EXPECT_TRUE(catalog.get("orders")->bounds("id")->min_exact);
+
+    StatisticsDelta delete_min;
+    remove(delete_min, 1);
+    catalog.commit(delete_min);
+    auto statistics = catalog.get("orders");
+    EXPECT_EQ(statistics->row_count, 2u);
+    EXPECT_FALSE(statistics->bounds("id")->min_exact);
+    EXPECT_TRUE(statistics->bounds("id")->max_exact);
+
+    // A new smaller value is the minimum again, whatever happened before.
+    StatisticsDelta insert_smaller;
+    insert(insert_smaller, 0);
+    catalog.commit(insert_smaller);
+    EXPECT_TRUE(catalog.get("orders")->bounds("id")->min_exact);
+    EXPECT_EQ(std::get<int64_t>(*catalog.get("orders")->bounds("id")->min), 0);
+}
+
+TEST_F(TableStatisticsTest, RefreshAndEmptyTableResetBounds) {
+    StatisticsDelta load;
+    insert(load, 7);
+    insert(load, 8);
+    catalog.commit(load);
+
+    StatisticsDelta delete_max;
+    remove(delete_max, 8);
+    catalog.commit(delete_max);
+    EXPECT_FALSE(catalog.get("orders")->bounds("id")->max_exact);
+
+    catalog.refresh_bounds("orders", "id", int64_t{7}, int64_t{7});
+    EXPECT_TRUE(catalog.get("orders")->bounds("id")->max_exact);
+    EXPECT_EQ(std::get<int64_t>(*catalog.get("orders")->bounds("id")->max), 7);
+
+    StatisticsDelta delete_all;
+    remove(delete_all, 7);
+    catalog.commit(delete_all);
+    auto statistics = catalog.get("orders");
+    EXPECT_EQ(statistics->row_count, 0u);
+    EXPECT_FALSE(statistics->bounds("id")->min.has_value());
+    EXPECT_TRUE(statistics->bounds("id")->min_exact);
+}
+
+TEST_F(TableStatisticsTest, StoresAnalyzeResults) {
+    ColumnStatistics id;
+    id.distinct_count = 1000;
+    catalog.store_analysis("Orders", 1000, {{"ID", id}});
+
+    ColumnStatistics status;
+    status.distinct_count = 3;
+    catalog.store_analysis("orders", 1200, {{"status", status}});
+
+    auto statistics = catalog.get("orders");
+    ASSERT_TRUE(statistics.has_value());
+    EXPECT_DOUBLE_EQ(statistics->analyzed_row_count, 1200);
+    ASSERT_NE(statistics->column_statistics("id"), nullptr);
+    EXPECT_DOUBLE_EQ(statistics->column_statistics("id")->distinct_count, 1000);
+    EXPECT_DOUBLE_EQ(statistics->column_statistics("STATUS")->distinct_count, 3);
+    EXPECT_EQ(statistics->column_statistics("total"), nullptr);
+    // Indexed column bounds are untouched.
+    EXPECT_NE(statistics->bounds("id"), nullptr);
+
+    catalog.store_analysis("customers", 10, {});
+    EXPECT_TRUE(catalog.get("customers").has_value());
+}
@@ -0,0 +1,106 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "common/arena.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace minidb;
+
+class ArenaTest : public ::testing::Test {
+protected:
+    ChunkPool pool{1024, 4};
+};
+
+TEST_F(ArenaTest, AllocationsAreAlignedAndDisjoint) {
+    Arena arena(pool);
+    auto *a = static_cast<char *>(arena.allocate(3, 1));
+    auto *b = static_cast<int64_t *>(arena.allocate(sizeof(int64_t), alignof(int64_t)));
+    auto *c = static_cast<double *>(arena.allocate(sizeof(double), 32));
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % alignof(int64_t), 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(c) % 32, 0);
+    EXPECT_GE(reinterpret_cast<char *>(b), a + 3);
+    EXPECT_GE(reinterpret_cast<char *>(c), reinterpret_cast<char *>(b + 1));
+    EXPECT_EQ(arena.stats().allocations, 3);
+    EXPECT_EQ(arena.stats().chunks_used, 1);
+}
+
+TEST_F(ArenaTest, GrowsIntoNewChunks) {
+    Arena arena(pool);
+    for (int i = 0; i < 100; ++i) {
+        arena.allocate(96, 8);
+    }
+    EXPECT_EQ(arena.stats().allocations, 100);
+    EXPECT_EQ(arena.stats().chunks_used, 10); // 10 allocations of 96 bytes fit in a 1024 byte chunk
+    EXPECT_EQ(arena.stats().large_allocations, 0);
+}
+
+TEST_F(ArenaTest, OversizedRequestsBypassChunks) {
+    Arena arena(pool);
+    auto *block = static_cast<char *>(arena.allocate(4096));
+    std::memset(block, 0xAB, 4096);
+    EXPECT_EQ(arena.stats().large_allocations, 1);
+    EXPECT_EQ(arena.stats().chunks_used, 0);
+}
+
+TEST_F(ArenaTest, ChunksAreReusedAcrossQueries) {
+    {
+        Arena first_query(pool);
+        for (int i = 0; i < 20; ++i) first_query.allocate(200);
+    }
+    size_t allocated_after_first = pool.chunks_allocated();
+    EXPECT_GT(allocated_after_first, 0);
+
+    {
+        Arena second_query(pool);
+        for (int i = 0; i < 8; ++i) second_query.allocate(200);
+    }
+    // The second query fits in the chunks cached by the pool (capacity 4).
+    EXPECT_EQ(pool.chunks_allocated(), allocated_after_first);
+    EXPECT_GT(pool.chunks_reused(), 0);
+}
+
+TEST_F(ArenaTest, ResetRunsDestructorsInReverseOrder) {
+    std::vector<int> destroyed;
+    struct Tracker {
+        Tracker(std::vector<int> *log, int id) : log(log), id(id) {}
+        ~Tracker() { log->push_back(id); }
+        std::vector<int> *log;
+        int id;
+    };
+
+    Arena arena(pool);
+    arena.make<Tracker>(&destroyed, 1);
+    arena.make<Tracker>(&destroyed, 2);
+    arena.make<Tracker>(&destroyed, 3);
+    EXPECT_TRUE(destroyed.empty());
+
+    arena.reset();
+    EXPECT_EQ(destroyed, (std::vector<int>{3, 2, 1}));
+    EXPECT_EQ(arena.stats().allocations, 0);
+}
+
+TEST_F(ArenaTest, CopyStringOwnsItsBytes) {
+    Arena arena(pool);
+    std::string source = "a string longer than the small string buffer";
+    std::string_view copy = arena.copy_string(source);
+    source.assign(source.size(), 'x');
+    EXPECT_EQ(copy, "a string longer than the small string buffer");
+    EXPECT_TRUE(arena.copy_string("").empty());
+}
+
+TEST_F(ArenaTest, ContainersCanUseArenaAllocator) {
+    Arena arena(pool);
+    std::vector<int64_t, ArenaAllocator<int64_t>> values{ArenaAllocator<int64_t>(&arena)};
+    for (int64_t i = 0; i < 50; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values.size(), 50);
+    EXPECT_EQ(values[49], 49);
+    EXPECT_GT(arena.stats().allocations, 1);
+}
@@ -0,0 +1,126 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/bulk_delete.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "storage/storage_def.h"
+#include "storage/table_page.h"
+
+using namespace minidb;
+
+class BulkDeleteTest : public ::testing::Test {
+protected:
+    static constexpr int ROWS_PER_PAGE = 10;
+
+    void SetUp() override {
+        std::filesystem::remove(db_file);
+        disk = std::make_unique<DiskManager>(db_file);
+
+        // Extents 1 and 2 hold the table; extent 0 holds the header and GAM pages.
+        char buffer[PAGE_SIZE];
+        std::memset(buffer, 0, sizeof(buffer));
+        auto gam_page = new (buffer) BitmapPage();
+        gam_page->page_type = PageType::GAM;
+        Bitmap gam(gam_page->bitmap, sizeof(gam_page->bitmap) * 8);
+        gam.set(0);
+        gam.set(1);
+        gam.set(2);
+        ASSERT_EQ(disk->write_page(FIRST_GAM_PAGE_ID, buffer), IOResult::SUCCESS);
+
+        for (page_id_t page_id = EXTENT_SIZE; page_id < 3 * EXTENT_SIZE; page_id++) {
+            TablePage page(buffer);
+            page.init();
+            for (int row = 0; row < ROWS_PER_PAGE; row++) {
+                page.insert_record("page" + std::to_string(page_id) + "row" + std::to_string(row));
+            }
+            ASSERT_EQ(disk->write_page(page_id, buffer), IOResult::SUCCESS);
+        }
+    }
+
+    void TearDown() override {
+        disk.reset();
+        std::filesystem::remove(db_file);
+    }
+
+    std::vector<RecordId> all_rows(page_id_t first_page_id, page_id_t last_page_id) {
+        std::vector<RecordId> rows;
+        for (page_id_t page_id = first_page_id; page_id <= last_page_id; page_id++) {
+            for (uint16_t slot = 0; slot < ROWS_PER_PAGE; slot++) {
+                rows.push_back(RecordId{page_id, slot});
+            }
+        }
+        return rows;
+    }
+
+    const std::string db_file = "bulk_delete_test.db";
+    std::unique_ptr<DiskManager> disk;
+};
+
+TEST_F(BulkDeleteTest, WritesEachPageOnceAndReportsSortedRows) {
+    BulkDelete bulk_delete(disk.get());
+    std::vector<RecordId> victims = {{9, 3}, {8, 1}, {9, 0}, {8, 1}, {8, 7}};
+
+    DeleteSummary summary = bulk_delete.execute(victims);
+    EXPECT_EQ(summary.rows_deleted, 4u);
+    EXPECT_EQ(summary.pages_written, 2u);
+    EXPECT_EQ(summary.deleted, (std::vector<RecordId>{{8, 1}, {8, 7}, {9, 0}, {9, 3}}));
+    EXPECT_TRUE(summary.freed_extents.empty());
+
+    char buffer[PAGE_SIZE];
+    ASSERT_EQ(disk->read_page(8, buffer), IOResult::SUCCESS);
+    TablePage page(buffer);
+    EXPECT_FALSE(page.get_record(1).has_value());
+    EXPECT_EQ(page.get_record(2).value(), "page8row2");
+
+    // Deleting the same rows again changes nothing.
+    EXPECT_EQ(bulk_delete.execute(victims).rows_deleted, 0u);
+}
+
+TEST_F(BulkDeleteTest, ReturnsEmptiedExtentsToTheGam) {
+    ExtentManager extents(disk.get());
+    BulkDelete bulk_delete(disk.get(), &extents);
+
+    // All of extent 2 and half of extent 1.
+    std::vector<RecordId> victims = all_rows(2 * EXTENT_SIZE, 3 * EXTENT_SIZE - 1);
+    std::vector<RecordId> partial = all_rows(EXTENT_SIZE, EXTENT_SIZE + 3);
+    victims.insert(victims.end(), partial.begin(), partial.end());
+
+    DeleteSummary summary = bulk_delete.execute(victims);
+    EXPECT_EQ(summary.rows_deleted, static_cast<size_t>(12 * ROWS_PER_PAGE));
+    EXPECT_EQ(summary.pages_written, 12u);
+    EXPECT_EQ(summary.freed_extents, (std::vector<page_id_t>{2 * EXTENT_SIZE}));
+
+    char buffer[PAGE_SIZE];
+    ASSERT_EQ(disk->read_page(FIRST_GAM_PAGE_ID, buffer), IOResult::SUCCESS);
+    auto gam_page = reinterpret_cast<BitmapPage *>(buffer);
+    Bitmap gam(gam_page->bitmap, sizeof(gam_page->bitmap) * 8);
+    EXPECT_TRUE(gam.is_set(1));
+    EXPECT_FALSE(gam.is_set(2));
+}
+
+TEST_F(BulkDeleteTest, ReclaimedSlotsGoToNewRows) {
+    ExtentManager extents(disk.get());
+    BulkDelete bulk_delete(disk.get(), &extents);
+    std::vector<RecordId> victims = all_rows(2 * EXTENT_SIZE, 3 * EXTENT_SIZE - 1);
+    victims.push_back({EXTENT_SIZE, 2});
+    victims.push_back({EXTENT_SIZE, 5});
+
+    DeleteSummary summary = bulk_delete.execute(victims);
+    char buffer[PAGE_SIZE];
+    ASSERT_EQ(disk->read_page(EXTENT_SIZE, buffer), IOResult::SUCCESS);
+    // Before the caller has dropped the index entries, the slots stay reserved.
+    EXPECT_EQ(TablePage(buffer).insert_record("new").value(), ROWS_PER_PAGE);
+
+    // The freed extent is not touched again.
+    EXPECT_EQ(bulk_delete.reclaim_slots(summary), 1u);
+    ASSERT_EQ(disk->read_page(EXTENT_SIZE, buffer), IOResult::SUCCESS);
+    TablePage page(buffer);
+    EXPECT_EQ(page.insert_record("new").value(), 2);
+    EXPECT_EQ(page.insert_record("newer").value(), 5);
+}
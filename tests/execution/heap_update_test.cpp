@@ -0,0 +1,63 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/heap_update.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "sql/lexer.h"
+#include "sql/parser.h"
+#include "storage/config.h"
+
+using namespace minidb;
+
+class HeapUpdateTest : public ::testing::Test {
+protected:
+    bool touches(const std::string &query, const std::vector<std::string> &indexed_columns) {
+        Lexer lexer(query);
+        Parser parser(lexer.tokenize());
+        auto ast = parser.parse();
+        auto *update = dynamic_cast<UpdateStatementNode *>(ast.get());
+        EXPECT_NE(update, nullptr);
+        return update_touches_columns(*update, indexed_columns);
+    }
+};
+
+TEST_F(HeapUpdateTest, DetectsAssignmentsToIndexedColumns) {
+    EXPECT_FALSE(touches("UPDATE counters SET hits = 5 WHERE id = 1;", {"id"}));
+    EXPECT_TRUE(touches("UPDATE counters SET hits = 5, ID = 2 WHERE id = 1;", {"id"}));
+    EXPECT_TRUE(touches("UPDATE counters SET hits = 5;", {"id", "hits"}));
+    EXPECT_FALSE(touches("UPDATE counters SET hits = 5;", {}));
+}
+
+TEST_F(HeapUpdateTest, IndexMaintenanceOnlyWhenRowMovesOrKeyChanges) {
+    EXPECT_FALSE(index_maintenance_required(UpdateResult::InPlace, false));
+    EXPECT_FALSE(index_maintenance_required(UpdateResult::HeapOnly, false));
+    EXPECT_TRUE(index_maintenance_required(UpdateResult::NoSpace, false));
+    EXPECT_TRUE(index_maintenance_required(UpdateResult::InPlace, true));
+}
+
+TEST_F(HeapUpdateTest, CounterIncrementsNeverWriteTheIndex) {
+    char page_data[PAGE_SIZE];
+    TablePage page(page_data);
+    page.init();
+    std::vector<uint16_t> slots;
+    for (int row = 0; row < 50; row++) {
+        slots.push_back(page.insert_record("id=" + std::to_string(row) + ";hits=0").value());
+    }
+
+    bool key_changes = touches("UPDATE counters SET hits = hits + 1 WHERE id = 3;", {"id"});
+    int index_writes = 0;
+    for (int hits = 1; hits <= 1000; hits++) {
+        for (uint16_t slot : slots) {
+            std::string record = "id=" + std::to_string(slot) + ";hits=" + std::to_string(hits);
+            UpdateResult result = page.update_record(slot, record);
+            ASSERT_NE(result, UpdateResult::NoSpace);
+            index_writes += index_maintenance_required(result, key_changes);
+        }
+    }
+    EXPECT_EQ(index_writes, 0);
+    EXPECT_EQ(page.get_record(slots[7]).value(), "id=7;hits=1000");
+}
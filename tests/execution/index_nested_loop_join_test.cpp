@@ -0,0 +1,148 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/index_nested_loop_join.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using namespace minidb;
+
+/**
+ * Ordered index test double laid out in fixed-size leaves. It counts root-to-leaf
+ * descents so tests can check that sorted probes reuse the current leaf.
+ */
+class LeafIndex {
+public:
+    using Entry = std::pair<int64_t, RecordId>;
+
+    LeafIndex(std::vector<Entry> sorted_entries, size_t leaf_size)
+            : entries(std::move(sorted_entries)), leaf_size(leaf_size) {}
+
+    class Cursor {
+    public:
+        Cursor(const LeafIndex *index, size_t position) : index(index), position(position) {}
+
+        bool valid() const { return position < index->entries.size(); }
+
+        int64_t key() const { return index->entries[position].first; }
+
+        RecordId record_id() const { return index->entries[position].second; }
+
+        void next() { position++; }
+
+        void seek_forward(int64_t target) {
+            if (!valid()) return;
+            size_t leaf_end = std::min(index->entries.size(), (position / index->leaf_size + 1) * index->leaf_size);
+            if (index->entries[leaf_end - 1].first >= target) {
+                // The target is in the current leaf: no descent needed.
+                auto begin = index->entries.begin();
+                position = std::lower_bound(begin + position, begin + leaf_end, target,
+                                            [](const Entry &e, int64_t k) { return e.first < k; }) - begin;
+                return;
+            }
+            *this = index->seek(target);
+        }
+
+    private:
+        const LeafIndex *index;
+        size_t position;
+    };
+
+    Cursor seek(int64_t key) const {
+        descents++;
+        auto it = std::lower_bound(entries.begin(), entries.end(), key,
+                                   [](const Entry &e, int64_t k) { return e.first < k; });
+        return Cursor(this, it - entries.begin());
+    }
+
+    void prefetch(int64_t) const { prefetches++; }
+
+    mutable size_t descents = 0;
+    mutable size_t prefetches = 0;
+
+private:
+    std::vector<Entry> entries;
+    size_t leaf_size;
+};
+
+class IndexNestedLoopJoinTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::vector<LeafIndex::Entry> entries;
+        // Even keys 0..1998, key 500 appears twice.
+        for (int64_t key = 0; key < 2000; key += 2) {
+            entries.push_back({key, {static_cast<page_id_t>(key / 100), static_cast<uint16_t>(key % 100)}});
+            if (key == 500) {
+                entries.push_back({key, {99, 99}});
+            }
+        }
+        index = std::make_unique<LeafIndex>(std::move(entries), 32);
+    }
+
+    static std::multimap<uint32_t, RecordId> as_map(const std::vector<JoinMatch> &matches) {
+        std::multimap<uint32_t, RecordId> out;
+        for (const auto &m : matches) out.insert({m.outer_row, m.inner});
+        return out;
+    }
+
+    std::unique_ptr<LeafIndex> index;
+};
+
+TEST_F(IndexNestedLoopJoinTest, FindsAllMatches) {
+    std::vector<int64_t> outer = {10, 11, 500, 1998, 2000, -4, 0};
+    IndexNestedLoopJoin<LeafIndex> join(*index);
+    auto matches = as_map(join.join(outer.data(), outer.size()));
+
+    ASSERT_EQ(matches.size(), 5);
+    EXPECT_EQ(matches.count(0), 1);
+    EXPECT_EQ(matches.find(0)->second, (RecordId{0, 10}));
+    EXPECT_EQ(matches.count(1), 0);
+    EXPECT_EQ(matches.count(2), 2); // duplicate index entries for 500
+    EXPECT_EQ(matches.count(3), 1);
+    EXPECT_EQ(matches.count(4), 0);
+    EXPECT_EQ(matches.count(6), 1);
+}
+
+TEST_F(IndexNestedLoopJoinTest, DuplicateOuterKeysReuseMatches) {
+    std::vector<int64_t> outer = {500, 42, 500, 500};
+    IndexNestedLoopJoin<LeafIndex> join(*index);
+    auto matches = as_map(join.join(outer.data(), outer.size()));
+
+    EXPECT_EQ(matches.size(), 7);
+    EXPECT_EQ(matches.count(0), 2);
+    EXPECT_EQ(matches.count(2), 2);
+    EXPECT_EQ(matches.count(3), 2);
+    // One descent for 42 and one for 500, which lives in a later leaf; the repeats of 500 are free.
+    EXPECT_EQ(index->descents, 2);
+}
+
+TEST_F(IndexNestedLoopJoinTest, SortedProbesShareLeaves) {
+    // 200 outer keys, clustered in a few leaves and given in random-looking order.
+    std::vector<int64_t> outer;
+    for (int64_t i = 0; i < 200; ++i) {
+        outer.push_back(((i * 37) % 200) * 2);
+    }
+
+    IndexNestedLoopJoin<LeafIndex> join(*index, 64);
+    auto matches = join.join(outer.data(), outer.size());
+
+    EXPECT_EQ(matches.size(), 200);
+    // 4 batches; each one descends once plus once per leaf boundary it crosses.
+    // Unsorted probing would descend once per outer key.
+    EXPECT_LE(index->descents, 4 * 7); // keys 0..398 span 7 leaves
+    EXPECT_EQ(index->prefetches, outer.size());
+}
+
+TEST_F(IndexNestedLoopJoinTest, BatchSizeDoesNotChangeResult) {
+    std::vector<int64_t> outer;
+    for (int64_t i = 0; i < 300; ++i) outer.push_back((i * 13) % 1100);
+
+    IndexNestedLoopJoin<LeafIndex> small_batches(*index, 7);
+    IndexNestedLoopJoin<LeafIndex> one_batch(*index, 1000);
+    EXPECT_EQ(as_map(small_batches.join(outer.data(), outer.size())),
+              as_map(one_batch.join(outer.data(), outer.size())));
+}
@@ -0,0 +1,145 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/materialized_view.h"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include "../sql/test_utils.h"
+
+using namespace minidb;
+
+class MaterializedViewTest : public ::testing::Test {
+protected:
+    const SelectStatementNode &select(const std::string &query) {
+        return parse_statement_as<SelectStatementNode>(query, ast);
+    }
+
+    static ResultRow sale(const std::string &region, int64_t amount) {
+        return {Value(region), Value(amount)};
+    }
+
+    const std::vector<std::string> columns = {"region", "amount"};
+    std::unique_ptr<ASTNode> ast;
+};
+
+TEST_F(MaterializedViewTest, MaintainsAggregatesAcrossInsertsAndDeletes) {
+    MaterializedAggregateView view(
+            select("SELECT region, SUM(amount), COUNT(*), MIN(amount), MAX(amount) FROM sales GROUP BY region;"),
+            columns);
+    view.apply_inserts({sale("east", 10), sale("west", 5), sale("east", 30), sale("east", 20)});
+
+    ResultBatch rows = view.rows();
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(std::get<std::string>(rows[0][0]), "east");
+    EXPECT_EQ(std::get<int64_t>(rows[0][1]), 60);
+    EXPECT_EQ(std::get<int64_t>(rows[0][2]), 3);
+    EXPECT_EQ(std::get<int64_t>(rows[0][3]), 10);
+    EXPECT_EQ(std::get<int64_t>(rows[0][4]), 30);
+
+    // Deleting the current MIN and MAX does not need the base table.
+    view.apply_deletes({sale("east", 10), sale("east", 30)});
+    rows = view.rows();
+    EXPECT_EQ(std::get<int64_t>(rows[0][1]), 20);
+    EXPECT_EQ(std::get<int64_t>(rows[0][2]), 1);
+    EXPECT_EQ(std::get<int64_t>(rows[0][3]), 20);
+    EXPECT_EQ(std::get<int64_t>(rows[0][4]), 20);
+
+    // A group disappears with its last row.
+    view.apply_deletes({sale("west", 5)});
+    EXPECT_EQ(view.group_count(), 1u);
+}
+
+TEST_F(MaterializedViewTest, MatchesRecomputationUnderRandomChanges) {
+    MaterializedAggregateView view(
+            select("SELECT MAX(amount), region, COUNT(amount), SUM(amount), MIN(amount) FROM sales GROUP BY region;"),
+            columns);
+
+    std::mt19937 rng(7);
+    std::vector<ResultRow> table;
+    for (int step = 0; step < 2000; step++) {
+        if (!table.empty() && rng() % 3 == 0) {
+            size_t victim = rng() % table.size();
+            view.apply_deletes({table[victim]});
+            table.erase(table.begin() + static_cast<long>(victim));
+        } else {
+            ResultRow row = sale("r" + std::to_string(rng() % 7), static_cast<int64_t>(rng() % 1000));
+            view.apply_inserts({row});
+            table.push_back(row);
+        }
+    }
+
+    struct Expected { int64_t max = INT64_MIN, count = 0, sum = 0, min = INT64_MAX; };
+    std::map<std::string, Expected> expected;
+    for (const auto &row : table) {
+        Expected &e = expected[std::get<std::string>(row[0])];
+        int64_t amount = std::get<int64_t>(row[1]);
+        e.max = std::max(e.max, amount);
+        e.min = std::min(e.min, amount);
+        e.count++;
+        e.sum += amount;
+    }
+
+    ResultBatch rows = view.rows();
+    ASSERT_EQ(rows.size(), expected.size());
+    for (const auto &row : rows) {
+        const Expected &e = expected.at(std::get<std::string>(row[1]));
+        EXPECT_EQ(std::get<int64_t>(row[0]), e.max);
+        EXPECT_EQ(std::get<int64_t>(row[2]), e.count);
+        EXPECT_EQ(std::get<int64_t>(row[3]), e.sum);
+        EXPECT_EQ(std::get<int64_t>(row[4]), e.min);
+    }
+}
+
+TEST_F(MaterializedViewTest, RejectsQueriesThatCannotBeMaintained) {
+    EXPECT_THROW(MaterializedAggregateView(select("SELECT region, SUM(amount) FROM sales;"), columns),
+                 std::runtime_error);
+    EXPECT_THROW(MaterializedAggregateView(select("SELECT region FROM sales WHERE amount > 1 GROUP BY region;"), columns),
+                 std::runtime_error);
+    EXPECT_THROW(MaterializedAggregateView(select("SELECT amount, COUNT(*) FROM sales GROUP BY region;"), columns),
+                 std::runtime_error);
+    EXPECT_THROW(MaterializedAggregateView(select("SELECT region, AVG(amount) FROM sales GROUP BY region;"), columns),
+                 std::runtime_error);
+    EXPECT_THROW(MaterializedAggregateView(select("SELECT region, SUM(price) FROM sales GROUP BY region;"), columns),
+                 std::runtime_error);
+}
+
+TEST_F(MaterializedViewTest, RegistryRoutesBaseTableChanges) {
+    std::string query = "CREATE MATERIALIZED VIEW sales_by_region AS "
+                        "SELECT region, SUM(amount) FROM sales GROUP BY region;";
+    std::unique_ptr<ASTNode> statement;
+    auto &create = parse_statement_as<CreateMaterializedViewStatementNode>(query, statement);
+
+    MaterializedViewRegistry registry;
+    // The view starts from the rows already in the base table.
+    registry.create(create, columns, {sale("south", 7), sale("north", 1)});
+    EXPECT_THROW(registry.create(create, columns, {}), std::runtime_error);
+
+    registry.on_insert("SALES", {sale("north", 4), sale("north", 6)});
+    registry.on_insert("returns", {sale("north", 100)});
+    registry.on_delete("sales", {sale("north", 4)});
+
+    const MaterializedAggregateView *view = registry.find("Sales_By_Region");
+    ASSERT_NE(view, nullptr);
+    ResultBatch rows = view->rows();
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(std::get<int64_t>(rows[0][1]), 7);
+    EXPECT_EQ(std::get<int64_t>(rows[1][1]), 7);
+    EXPECT_EQ(registry.find("missing"), nullptr);
+}
+
+TEST_F(MaterializedViewTest, RejectsDeletesOfRowsItNeverSaw) {
+    MaterializedAggregateView view(select("SELECT region, MIN(amount), COUNT(*) FROM sales GROUP BY region;"), columns);
+    view.apply_inserts({sale("east", 10), sale("east", 20)});
+
+    EXPECT_THROW(view.apply_deletes({sale("west", 10)}), std::runtime_error);
+    EXPECT_THROW(view.apply_deletes({sale("east", 15)}), std::runtime_error);
+
+    // The rejected deletes left the view untouched.
+    ResultBatch rows = view.rows();
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(std::get<int64_t>(rows[0][1]), 10);
+    EXPECT_EQ(std::get<int64_t>(rows[0][2]), 2);
+}
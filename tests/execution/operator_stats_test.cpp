@@ -0,0 +1,76 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/operator_stats.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "execution/pipeline.h"
+
+using namespace minidb;
+
+TEST(OperatorStatsTest, TracksPeakMemory) {
+    OperatorStats stats;
+    stats.allocate(100);
+    stats.allocate(50);
+    stats.release(120);
+    stats.allocate(10);
+    EXPECT_EQ(stats.memory_bytes, 40u);
+    EXPECT_EQ(stats.peak_memory_bytes, 150u);
+    stats.release(1000);
+    EXPECT_EQ(stats.memory_bytes, 0u);
+}
+
+TEST(OperatorStatsTest, TimerMeasuresWallAndCpuTime) {
+    OperatorStats stats;
+    {
+        OperatorTimer timer(&stats);
+        volatile uint64_t sink = 0;
+        for (uint64_t i = 0; i < 5'000'000; i++) sink = sink + i;
+    }
+    EXPECT_GT(stats.wall_time.count(), 0);
+    EXPECT_GT(stats.cpu_time.count(), 0);
+    // A null stats pointer is a no-op.
+    OperatorTimer disabled(nullptr);
+}
+
+TEST(OperatorStatsTest, InstrumentsPipelineOperators) {
+    std::vector<int64_t> values(2500);
+    for (size_t i = 0; i < values.size(); i++) values[i] = static_cast<int64_t>(i);
+    auto fetch = [&](const RecordId &rid, column_id_t) -> Value { return values[rid.page_id + rid.slot]; };
+    std::vector<RowBatch> batches;
+    for (size_t start = 0; start < values.size(); start += 1000) {
+        std::vector<RecordId> rids;
+        for (size_t row = start; row < std::min<size_t>(start + 1000, values.size()); ++row) {
+            rids.push_back({static_cast<page_id_t>(start), static_cast<uint16_t>(row - start)});
+        }
+        batches.emplace_back(std::move(rids), 1);
+        batches.back().materialize(0, fetch);
+    }
+
+    OperatorStats scan, filter;
+    auto pipeline = make_timed(&scan, make_scan(
+            make_filter([](const RowRef &r) { return r.column(0) % 10 == 0; },
+            make_counting(&filter,
+            make_project([](const RowRef &r) { return r.column(0); }, SumAggregate<int64_t>())))));
+    for (const auto &batch : batches) pipeline.produce(batch);
+    pipeline.finish();
+
+    EXPECT_EQ(scan.batches, 3u);
+    EXPECT_EQ(scan.rows, 2500u);
+    EXPECT_EQ(filter.rows, 250u);
+    EXPECT_EQ(pipeline.sink().count, 250);
+    EXPECT_GT(scan.wall_time.count(), 0);
+    EXPECT_GT(scan.cpu_time.count(), 0);
+}
+
+TEST(OperatorStatsTest, NullStatsRunsThePipelineUninstrumented) {
+    RowBatch batch({{0, 0}, {0, 1}, {0, 2}, {0, 3}}, 1);
+    batch.materialize(0, [](const RecordId &rid, column_id_t) -> Value { return static_cast<int64_t>(rid.slot); });
+    auto pipeline = make_timed(nullptr, make_scan(
+            make_counting(nullptr, make_project([](const RowRef &r) { return r.column(0); }, SumAggregate<int64_t>()))));
+    pipeline.produce(batch);
+    pipeline.finish();
+    EXPECT_EQ(pipeline.sink().count, 4);
+}
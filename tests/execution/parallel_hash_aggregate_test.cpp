@@ -0,0 +1,124 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/parallel_hash_aggregate.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace minidb;
+
+class ParallelHashAggregateTest : public ::testing::Test {
+protected:
+    void generate(size_t rows, int64_t distinct_keys) {
+        std::mt19937_64 rng(7);
+        keys.resize(rows);
+        values.resize(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            keys[i] = static_cast<int64_t>(rng() % distinct_keys) - distinct_keys / 2;
+            values[i] = static_cast<int64_t>(rng() % 100);
+        }
+    }
+
+    std::map<int64_t, std::pair<int64_t, int64_t>> expected() const {
+        std::map<int64_t, std::pair<int64_t, int64_t>> groups;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            groups[keys[i]].first += values[i];
+            groups[keys[i]].second++;
+        }
+        return groups;
+    }
+
+    static void expect_matches(std::vector<AggregateGroup> actual,
+                               const std::map<int64_t, std::pair<int64_t, int64_t>> &expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        std::sort(actual.begin(), actual.end(), [](const auto &a, const auto &b) { return a.key < b.key; });
+        auto it = expected.begin();
+        for (const auto &group : actual) {
+            EXPECT_EQ(group.key, it->first);
+            EXPECT_EQ(group.sum, it->second.first) << "key " << group.key;
+            EXPECT_EQ(group.count, it->second.second) << "key " << group.key;
+            ++it;
+        }
+    }
+
+    std::vector<int64_t> keys, values;
+};
+
+TEST_F(ParallelHashAggregateTest, LowCardinalityStaysInLocalTables) {
+    generate(100000, 50);
+    ParallelHashAggregator aggregator(4);
+    expect_matches(aggregator.aggregate(keys.data(), values.data(), keys.size()), expected());
+    // Only the final flush per worker.
+    EXPECT_EQ(aggregator.last_flush_count(), 4);
+}
+
+TEST_F(ParallelHashAggregateTest, HighCardinalitySpillsToPartitions) {
+    generate(200000, 50000);
+    ParallelHashAggregator aggregator(4, 4, 256);
+    expect_matches(aggregator.aggregate(keys.data(), values.data(), keys.size()), expected());
+    EXPECT_GT(aggregator.last_flush_count(), 4);
+}
+
+TEST_F(ParallelHashAggregateTest, ResultIndependentOfThreadCount) {
+    generate(50000, 5000);
+    auto groups = expected();
+    for (size_t threads : {1, 2, 3, 8}) {
+        ParallelHashAggregator aggregator(threads, 3, 512);
+        expect_matches(aggregator.aggregate(keys.data(), values.data(), keys.size()), groups);
+    }
+}
+
+TEST_F(ParallelHashAggregateTest, MoreThreadsThanRows) {
+    generate(3, 10);
+    ParallelHashAggregator aggregator(8);
+    expect_matches(aggregator.aggregate(keys.data(), values.data(), keys.size()), expected());
+
+    EXPECT_TRUE(aggregator.aggregate(nullptr, nullptr, 0).empty());
+}
+
+TEST_F(ParallelHashAggregateTest, TinyLocalCapacity) {
+    generate(1000, 40);
+    for (size_t capacity : {0, 1, 2, 3}) {
+        ParallelHashAggregator aggregator(4, 4, capacity);
+        expect_matches(aggregator.aggregate(keys.data(), values.data(), keys.size()), expected());
+    }
+}
+
+TEST(PreAggregationTableTest, FlushRoutesGroupsByHashPartition) {
+    PreAggregationTable table(8, 2);
+    for (int64_t key = 0; key < 20; ++key) {
+        table.add(key, key);
+        table.add(key, 1);
+    }
+    table.flush();
+
+    size_t total = 0;
+    int64_t sum = 0;
+    for (const auto &partition : table.partitions()) {
+        for (const auto &group : partition) {
+            total += group.count;
+            sum += group.sum;
+        }
+    }
+    EXPECT_EQ(table.partitions().size(), 4);
+    EXPECT_EQ(total, 40);
+    EXPECT_EQ(sum, 190 + 20);
+    EXPECT_GT(table.flush_count(), 1);
+}
+
+TEST_F(ParallelHashAggregateTest, RejectsOutOfRangePartitionBits) {
+    generate(1000, 40);
+    ParallelHashAggregator single_partition(4, 0);
+    expect_matches(single_partition.aggregate(keys.data(), values.data(), keys.size()), expected());
+    EXPECT_EQ(PreAggregationTable(8, PreAggregationTable::MAX_PARTITION_BITS).partitions().size(), 65'536);
+
+    EXPECT_THROW(ParallelHashAggregator(4, PreAggregationTable::MAX_PARTITION_BITS + 1), std::invalid_argument);
+    EXPECT_THROW(ParallelHashAggregator(4, 64), std::invalid_argument);
+    EXPECT_THROW(PreAggregationTable(8, 64), std::invalid_argument);
+}
@@ -0,0 +1,116 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/pipeline.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+using namespace minidb;
+
+class PipelineTest : public ::testing::Test {
+protected:
+    static constexpr column_id_t ID = 0;
+    static constexpr column_id_t AGE = 1;
+    static constexpr column_id_t SALARY = 2;
+
+    void SetUp() override {
+        for (int64_t i = 0; i < 100; ++i) {
+            ids.push_back(i);
+            ages.push_back(20 + i % 50);
+            salaries.push_back(1000 + i);
+        }
+    }
+
+    // Splits the table into batches of the given size, with every column decoded.
+    std::vector<RowBatch> batches(size_t batch_size) {
+        auto fetch = [this](const RecordId &rid, column_id_t column) -> Value {
+            const std::vector<int64_t> *table[] = {&ids, &ages, &salaries};
+            return (*table[column])[rid.slot];
+        };
+        std::vector<RowBatch> out;
+        for (size_t start = 0; start < ids.size(); start += batch_size) {
+            std::vector<RecordId> rids;
+            for (size_t row = start; row < std::min(start + batch_size, ids.size()); ++row) {
+                rids.push_back({0, static_cast<uint16_t>(row)});
+            }
+            RowBatch batch(std::move(rids), 3);
+            for (column_id_t column : {ID, AGE, SALARY}) batch.materialize(column, fetch);
+            out.push_back(std::move(batch));
+        }
+        return out;
+    }
+
+    std::vector<int64_t> ids, ages, salaries;
+};
+
+TEST_F(PipelineTest, ScanFilterProjectSum) {
+    auto pipeline = make_scan(
+            make_filter([](const RowRef &r) { return r.column(AGE) >= 60; },
+                        make_project([](const RowRef &r) { return r.column(SALARY); },
+                                     SumAggregate<int64_t>())));
+
+    for (const auto &batch : batches(16)) {
+        pipeline.produce(batch);
+    }
+    pipeline.finish();
+
+    int64_t expected_sum = 0, expected_count = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (ages[i] >= 60) {
+            expected_sum += salaries[i];
+            expected_count++;
+        }
+    }
+    EXPECT_TRUE(pipeline.sink().finished);
+    EXPECT_EQ(pipeline.sink().count, expected_count);
+    EXPECT_EQ(pipeline.sink().sum, expected_sum);
+}
+
+TEST_F(PipelineTest, ResultIsIndependentOfBatchSize) {
+    auto run = [this](size_t batch_size) {
+        auto pipeline = make_scan(
+                make_project([](const RowRef &r) { return r.column(ID) * 2; },
+                             make_filter([](int64_t doubled) { return doubled % 3 == 0; },
+                                         SumAggregate<int64_t>())));
+        for (const auto &batch : batches(batch_size)) {
+            pipeline.produce(batch);
+        }
+        pipeline.finish();
+        return pipeline.sink().sum;
+    };
+
+    EXPECT_EQ(run(1), run(7));
+    EXPECT_EQ(run(7), run(100));
+}
+
+TEST_F(PipelineTest, StackedFiltersAndProjections) {
+    auto pipeline = make_scan(
+            make_filter([](const RowRef &r) { return r.column(AGE) < 30; },
+                        make_filter([](const RowRef &r) { return r.column(ID) % 2 == 0; },
+                                    make_project([](const RowRef &r) { return static_cast<double>(r.column(SALARY)) / 2; },
+                                                 SumAggregate<double>()))));
+    for (const auto &batch : batches(32)) {
+        pipeline.produce(batch);
+    }
+    pipeline.finish();
+
+    // Ages 20..29 occur for ids 0..9 and 50..59; even ids among those: 10 rows.
+    EXPECT_EQ(pipeline.sink().count, 10);
+    EXPECT_DOUBLE_EQ(pipeline.sink().sum, (1000 + 1002 + 1004 + 1006 + 1008 + 1050 + 1052 + 1054 + 1056 + 1058) / 2.0);
+}
+
+TEST_F(PipelineTest, ScanSkipsRowsOutsideTheSelection) {
+    auto pipeline = make_scan(make_project([](const RowRef &r) { return r.column(ID); }, SumAggregate<int64_t>()));
+    for (auto &batch : batches(10)) {
+        batch.refine([](uint32_t row) { return row < 2; });
+        pipeline.produce(batch);
+    }
+    pipeline.finish();
+
+    // Ids 0, 1, 10, 11, ..., 90, 91.
+    EXPECT_EQ(pipeline.sink().count, 20);
+    EXPECT_EQ(pipeline.sink().sum, 2 * (0 + 10 + 20 + 30 + 40 + 50 + 60 + 70 + 80 + 90) + 10);
+}
@@ -0,0 +1,91 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/result_cache.h"
+
+#include <gtest/gtest.h>
+
+using namespace minidb;
+
+namespace {
+
+    ResultBatch rows(int64_t count) {
+        ResultBatch batch;
+        for (int64_t i = 0; i < count; i++) {
+            batch.push_back({Value(i)});
+        }
+        return batch;
+    }
+
+} // namespace
+
+TEST(ResultCacheTest, HitAfterInsertAndMissBefore) {
+    ResultCache cache(1 << 20);
+    ResultCacheKey key = cache.make_key("SELECT a FROM t", {"t"});
+    EXPECT_EQ(cache.lookup(key), nullptr);
+
+    cache.insert(key, rows(3));
+    auto cached = cache.lookup(cache.make_key("SELECT a FROM t", {"T"}));
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->size(), 3u);
+
+    ResultCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_GT(stats.bytes, 0u);
+}
+
+TEST(ResultCacheTest, WriteToReadTableInvalidates) {
+    ResultCache cache(1 << 20);
+    cache.insert(cache.make_key("q1", {"orders", "users"}), rows(1));
+    cache.insert(cache.make_key("q2", {"products"}), rows(1));
+
+    cache.table_changed("USERS");
+    EXPECT_EQ(cache.lookup(cache.make_key("q1", {"orders", "users"})), nullptr);
+    EXPECT_NE(cache.lookup(cache.make_key("q2", {"products"})), nullptr);
+
+    ResultCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.invalidations, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(cache.table_version("users"), 1u);
+}
+
+TEST(ResultCacheTest, ResultComputedBeforeAWriteIsNotCached) {
+    ResultCache cache(1 << 20);
+    ResultCacheKey key = cache.make_key("q", {"t"});
+    cache.table_changed("t"); // Concurrent write while the query runs.
+    cache.insert(key, rows(1));
+
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_EQ(cache.lookup(cache.make_key("q", {"t"})), nullptr);
+}
+
+TEST(ResultCacheTest, EvictsLeastRecentlyUsedToStayUnderBound) {
+    ResultCache probe(1 << 20);
+    probe.insert(probe.make_key("q0", {"t"}), rows(100));
+    size_t entry_bytes = probe.stats().bytes;
+
+    ResultCache cache(entry_bytes * 2 + entry_bytes / 2);
+    cache.insert(cache.make_key("q0", {"t"}), rows(100));
+    cache.insert(cache.make_key("q1", {"t"}), rows(100));
+    ASSERT_NE(cache.lookup(cache.make_key("q0", {"t"})), nullptr); // q1 is now least recently used
+    cache.insert(cache.make_key("q2", {"t"}), rows(100));
+
+    EXPECT_NE(cache.lookup(cache.make_key("q0", {"t"})), nullptr);
+    EXPECT_EQ(cache.lookup(cache.make_key("q1", {"t"})), nullptr);
+    EXPECT_NE(cache.lookup(cache.make_key("q2", {"t"})), nullptr);
+
+    ResultCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_LE(stats.bytes, entry_bytes * 2 + entry_bytes / 2);
+}
+
+TEST(ResultCacheTest, ZeroBoundDisablesCaching) {
+    ResultCache cache(0);
+    ResultCacheKey key = cache.make_key("q", {"t"});
+    cache.insert(key, rows(1));
+    EXPECT_EQ(cache.lookup(key), nullptr);
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
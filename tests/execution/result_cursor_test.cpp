@@ -0,0 +1,119 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/result_cursor.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace minidb;
+
+namespace {
+    ResultBatch make_batch(int64_t first, size_t rows) {
+        ResultBatch batch;
+        for (size_t i = 0; i < rows; ++i) {
+            batch.push_back({static_cast<int64_t>(first + i)});
+        }
+        return batch;
+    }
+
+    // Polls until `count` reaches `target`, giving up after a generous deadline.
+    bool wait_for_count(const std::atomic<int> &count, int target) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (count.load() < target) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST(ResultCursorTest, DeliversAllBatchesInOrder) {
+    ResultCursor cursor([](const ResultCursor::Emit &emit) {
+        for (int64_t b = 0; b < 10; ++b) {
+            if (!emit(make_batch(b * 4, 4))) return;
+        }
+    });
+
+    ResultBatch batch;
+    int64_t expected = 0;
+    while (cursor.next(batch)) {
+        for (const auto &row : batch) {
+            EXPECT_EQ(std::get<int64_t>(row[0]), expected++);
+        }
+    }
+    EXPECT_EQ(expected, 40);
+    EXPECT_FALSE(cursor.next(batch));
+}
+
+TEST(ResultCursorTest, FirstBatchArrivesBeforeQueryFinishes) {
+    std::atomic<bool> release{false};
+    ResultCursor cursor([&](const ResultCursor::Emit &emit) {
+        emit(make_batch(0, 1));
+        // The rest of the query is slow; the consumer must not wait for it.
+        while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        emit(make_batch(1, 1));
+    });
+
+    ResultBatch batch;
+    ASSERT_TRUE(cursor.next(batch));
+    EXPECT_EQ(std::get<int64_t>(batch[0][0]), 0);
+    release = true;
+    ASSERT_TRUE(cursor.next(batch));
+    EXPECT_EQ(std::get<int64_t>(batch[0][0]), 1);
+    EXPECT_FALSE(cursor.next(batch));
+}
+
+TEST(ResultCursorTest, ProducerIsThrottledByConsumer) {
+    std::atomic<int> produced{0};
+    ResultCursor cursor([&](const ResultCursor::Emit &emit) {
+        for (int b = 0; b < 100; ++b) {
+            if (!emit(make_batch(b, 1))) return;
+            produced++;
+        }
+    }, 2);
+
+    // Two batches fit in the buffer; the third push blocks.
+    ASSERT_TRUE(wait_for_count(produced, 2));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(produced.load(), 2);
+
+    ResultBatch batch;
+    ASSERT_TRUE(cursor.next(batch));
+    ASSERT_TRUE(wait_for_count(produced, 3));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(produced.load(), 3);
+}
+
+TEST(ResultCursorTest, CloseStopsProducer) {
+    std::atomic<bool> stopped{false};
+    {
+        ResultCursor cursor([&](const ResultCursor::Emit &emit) {
+            for (int b = 0; b < 1000000; ++b) {
+                if (!emit(make_batch(b, 1))) break;
+            }
+            stopped = true;
+        }, 1);
+        ResultBatch batch;
+        ASSERT_TRUE(cursor.next(batch));
+        cursor.close();
+        EXPECT_FALSE(cursor.next(batch));
+    }
+    EXPECT_TRUE(stopped);
+}
+
+TEST(ResultCursorTest, ProducerErrorIsRethrownAfterDeliveredBatches) {
+    ResultCursor cursor([](const ResultCursor::Emit &emit) {
+        emit(make_batch(0, 2));
+        throw std::runtime_error("disk read failed");
+    });
+
+    ResultBatch batch;
+    ASSERT_TRUE(cursor.next(batch));
+    EXPECT_EQ(batch.size(), 2);
+    EXPECT_THROW(cursor.next(batch), std::runtime_error);
+}
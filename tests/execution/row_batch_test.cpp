@@ -0,0 +1,126 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/row_batch.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace minidb;
+
+class RowBatchTest : public ::testing::Test {
+protected:
+    static constexpr column_id_t ID = 0;
+    static constexpr column_id_t AGE = 1;
+    static constexpr column_id_t NAME = 2;
+
+    void SetUp() override {
+        for (uint16_t slot = 0; slot < 10; ++slot) {
+            rids.push_back({3, slot});
+        }
+    }
+
+    // Fake table where every column value is derived from the slot. Counts decodes per column.
+    Value fetch(const RecordId &rid, column_id_t column) {
+        fetch_counts[column]++;
+        switch (column) {
+            case ID:
+                return static_cast<int64_t>(rid.slot);
+            case AGE:
+                return static_cast<int64_t>(20 + rid.slot * 5);
+            default:
+                return std::string("user") + std::to_string(rid.slot);
+        }
+    }
+
+    std::vector<RecordId> rids;
+    int fetch_counts[3] = {0, 0, 0};
+};
+
+TEST(SelectionVectorTest, StartsWithAllRowsSelected) {
+    SelectionVector sel(5);
+    ASSERT_EQ(sel.size(), 5);
+    for (uint32_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(sel[i], i);
+    }
+}
+
+TEST(SelectionVectorTest, RefineKeepsOrderOfSurvivors) {
+    SelectionVector sel(10);
+    EXPECT_EQ(sel.refine([](uint32_t row) { return row % 3 == 0; }), 4);
+    EXPECT_EQ(std::vector<uint32_t>(sel.begin(), sel.end()), (std::vector<uint32_t>{0, 3, 6, 9}));
+
+    EXPECT_EQ(sel.refine([](uint32_t row) { return row > 3; }), 2);
+    EXPECT_EQ(std::vector<uint32_t>(sel.begin(), sel.end()), (std::vector<uint32_t>{6, 9}));
+
+    sel.refine([](uint32_t) { return false; });
+    EXPECT_TRUE(sel.empty());
+}
+
+TEST_F(RowBatchTest, FilterDecodesOnlyFilterColumn) {
+    RowBatch batch(rids, 3);
+    auto fetcher = [this](const RecordId &rid, column_id_t c) { return fetch(rid, c); };
+
+    size_t survivors = batch.filter(AGE, fetcher, [](const Value &v) { return std::get<int64_t>(v) >= 55; });
+
+    EXPECT_EQ(survivors, 3); // slots 7, 8, 9
+    EXPECT_EQ(fetch_counts[AGE], 10);
+    EXPECT_EQ(fetch_counts[ID], 0);
+    EXPECT_EQ(fetch_counts[NAME], 0);
+    EXPECT_TRUE(batch.is_materialized(AGE));
+    EXPECT_FALSE(batch.is_materialized(NAME));
+}
+
+TEST_F(RowBatchTest, ProjectFetchesRemainingColumnsForSurvivorsOnly) {
+    RowBatch batch(rids, 3);
+    auto fetcher = [this](const RecordId &rid, column_id_t c) { return fetch(rid, c); };
+
+    batch.filter(AGE, fetcher, [](const Value &v) { return std::get<int64_t>(v) >= 55; });
+    auto rows = batch.project({ID, NAME, AGE}, fetcher);
+
+    ASSERT_EQ(rows.size(), 3);
+    EXPECT_EQ(std::get<int64_t>(rows[0][0]), 7);
+    EXPECT_EQ(std::get<std::string>(rows[0][1]), "user7");
+    EXPECT_EQ(std::get<int64_t>(rows[0][2]), 55);
+    EXPECT_EQ(std::get<std::string>(rows[2][1]), "user9");
+
+    // Age was decoded once during the filter; id and name only for the 3 survivors.
+    EXPECT_EQ(fetch_counts[AGE], 10);
+    EXPECT_EQ(fetch_counts[ID], 3);
+    EXPECT_EQ(fetch_counts[NAME], 3);
+    EXPECT_EQ(batch.decoded_value_count(), 16);
+}
+
+TEST_F(RowBatchTest, ChainedFiltersOnlyDecodeSurvivingRows) {
+    RowBatch batch(rids, 3);
+    auto fetcher = [this](const RecordId &rid, column_id_t c) { return fetch(rid, c); };
+
+    batch.filter(ID, fetcher, [](const Value &v) { return std::get<int64_t>(v) % 2 == 0; });
+    batch.filter(AGE, fetcher, [](const Value &v) { return std::get<int64_t>(v) > 30; });
+
+    EXPECT_EQ(fetch_counts[ID], 10);
+    EXPECT_EQ(fetch_counts[AGE], 5);
+    EXPECT_EQ(batch.selected_count(), 3); // slots 4, 6, 8
+}
+
+TEST_F(RowBatchTest, TakeCarriesDecodedColumnsAndRecordIds) {
+    RowBatch batch(rids, 3);
+    auto fetcher = [this](const RecordId &rid, column_id_t c) { return fetch(rid, c); };
+    batch.filter(AGE, fetcher, [](const Value &v) { return std::get<int64_t>(v) >= 55; });
+
+    // A join matched position 8 twice and position 9 once.
+    RowBatch joined = batch.take({8, 8, 9});
+
+    ASSERT_EQ(joined.row_count(), 3);
+    EXPECT_EQ(joined.record_ids()[0], (RecordId{3, 8}));
+    EXPECT_EQ(joined.record_ids()[2], (RecordId{3, 9}));
+    EXPECT_TRUE(joined.is_materialized(AGE));
+    EXPECT_FALSE(joined.is_materialized(NAME));
+
+    auto rows = joined.project({NAME}, fetcher);
+    ASSERT_EQ(rows.size(), 3);
+    EXPECT_EQ(std::get<std::string>(rows[1][0]), "user8");
+    EXPECT_EQ(fetch_counts[NAME], 3);
+    EXPECT_EQ(fetch_counts[AGE], 10);
+}
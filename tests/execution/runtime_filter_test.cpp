@@ -0,0 +1,102 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "execution/runtime_filter.h"
+#include "execution/pipeline.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+using namespace minidb;
+
+TEST(BloomFilterTest, NoFalseNegatives) {
+    BloomFilter bloom(10000);
+    for (int64_t key = 0; key < 10000; ++key) {
+        bloom.insert(key * 31);
+    }
+    for (int64_t key = 0; key < 10000; ++key) {
+        EXPECT_TRUE(bloom.might_contain(key * 31)) << key;
+    }
+}
+
+TEST(BloomFilterTest, FalsePositiveRateIsLow) {
+    BloomFilter bloom(10000);
+    for (int64_t key = 0; key < 10000; ++key) {
+        bloom.insert(key);
+    }
+    int false_positives = 0;
+    for (int64_t key = 1000000; key < 1100000; ++key) {
+        false_positives += bloom.might_contain(key) ? 1 : 0;
+    }
+    EXPECT_LT(false_positives, 3000); // under 3% of 100k probes
+}
+
+TEST(RuntimeFilterTest, RangeCheckRejectsOutsideKeys) {
+    std::vector<int64_t> keys = {10, 20, 30};
+    RuntimeFilter filter = RuntimeFilter::build(keys.data(), keys.size());
+    EXPECT_EQ(filter.min(), 10);
+    EXPECT_EQ(filter.max(), 30);
+    EXPECT_TRUE(filter.might_contain(20));
+    EXPECT_FALSE(filter.might_contain(9));
+    EXPECT_FALSE(filter.might_contain(31));
+    EXPECT_FALSE(filter.empty());
+}
+
+TEST(RuntimeFilterTest, EmptyBuildSideRejectsEverything) {
+    RuntimeFilter filter = RuntimeFilter::build(nullptr, 0);
+    EXPECT_TRUE(filter.empty());
+    EXPECT_FALSE(filter.might_contain(0));
+}
+
+TEST(RuntimeFilterTest, ScanDropsRowsWithoutJoinPartner) {
+    // Dimension: 1% of the fact table's foreign keys survive the dimension filter.
+    std::vector<int64_t> dimension_keys;
+    for (int64_t key = 0; key < 10000; key += 100) {
+        dimension_keys.push_back(key);
+    }
+    RuntimeFilter filter = RuntimeFilter::build(dimension_keys.data(), dimension_keys.size());
+    std::unordered_set<int64_t> build_side(dimension_keys.begin(), dimension_keys.end());
+
+    std::vector<int64_t> fact_keys, amounts;
+    for (int64_t i = 0; i < 100000; ++i) {
+        fact_keys.push_back((i * 7) % 10000);
+        amounts.push_back(i % 10);
+    }
+
+    // Probe pipeline: the join itself is modeled by an exact membership check after the scan.
+    auto scan = make_runtime_filter_scan(
+            0, &filter,
+            make_filter([&](const RowRef &r) { return build_side.count(r.column(0)) > 0; },
+                        make_project([](const RowRef &r) { return r.column(1); },
+                                     SumAggregate<int64_t>())));
+    // Record ids address the fact table as page = first row of the batch, slot = offset within it.
+    auto fetch = [&](const RecordId &rid, column_id_t column) -> Value {
+        return (column == 0 ? fact_keys : amounts)[rid.page_id + rid.slot];
+    };
+    for (size_t start = 0; start < fact_keys.size(); start += 1024) {
+        std::vector<RecordId> rids;
+        for (size_t row = start; row < std::min<size_t>(start + 1024, fact_keys.size()); ++row) {
+            rids.push_back({static_cast<page_id_t>(start), static_cast<uint16_t>(row - start)});
+        }
+        RowBatch batch(std::move(rids), 2);
+        batch.materialize(0, fetch);
+        batch.materialize(1, fetch);
+        scan.produce(batch);
+    }
+    scan.finish();
+
+    int64_t expected_sum = 0, expected_count = 0;
+    for (size_t i = 0; i < fact_keys.size(); ++i) {
+        if (build_side.count(fact_keys[i])) {
+            expected_sum += amounts[i];
+            expected_count++;
+        }
+    }
+    EXPECT_EQ(scan.sink().count, expected_count);
+    EXPECT_EQ(scan.sink().sum, expected_sum);
+    // Nearly all of the 99% non-matching rows were dropped inside the scan.
+    EXPECT_GT(scan.dropped_row_count(), 95000);
+}
@@ -0,0 +1,121 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "optimizer/access_path.h"
+
+#include <gtest/gtest.h>
+#include "optimizer/selectivity.h"
+#include "sql/expression_rewriter.h"
+#include "test_utils.h"
+
+using namespace minidb;
+
+class AccessPathTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 1M orders: 100,000 customers, amounts spread evenly over [0, 1000).
+        ColumnStatistics customer;
+        customer.distinct_count = 100'000;
+        ColumnStatisticsBuilder amount_builder(10'000);
+        for (int64_t i = 0; i < 10'000; i++) amount_builder.add(LiteralValue{i % 1000});
+        statistics.analyzed_row_count = 1'000'000;
+        statistics.columns["customer_id"] = customer;
+        statistics.columns["amount"] = amount_builder.build(1'000'000);
+
+        indexes = {{"orders_customer_created", {"customer_id", "created_at"}},
+                   {"orders_amount", {"amount"}}};
+    }
+
+    AccessPath choose(const std::string &where, const std::vector<IndexDefinition> &available) {
+        std::string query = "SELECT * FROM orders o WHERE " + where + ";";
+        auto &select = parse_statement_as<SelectStatementNode>(query, ast);
+        JoinRelation orders{"orders", "o", 1'000'000, 1'000'000};
+        return choose_access_path(orders, split_conjuncts(select.where_clause.get()), &statistics, available);
+    }
+
+    AccessPath choose(const std::string &where) { return choose(where, indexes); }
+
+    TableStatistics statistics;
+    std::vector<IndexDefinition> indexes;
+    std::unique_ptr<ASTNode> ast;
+};
+
+TEST_F(AccessPathTest, NoUsableIndexScansTable) {
+    AccessPath path = choose("o.status = 'open'", {});
+    EXPECT_EQ(path.method, AccessMethod::SEQ_SCAN);
+    EXPECT_TRUE(path.index_name.empty());
+    EXPECT_EQ(path.filter_conditions.size(), 1u);
+    EXPECT_DOUBLE_EQ(path.rows, 1'000'000 * DEFAULT_EQUALITY_SELECTIVITY);
+}
+
+TEST_F(AccessPathTest, SelectiveEqualityUsesIndexScan) {
+    AccessPath path = choose("o.customer_id = 42");
+    EXPECT_EQ(path.method, AccessMethod::INDEX_SCAN);
+    EXPECT_EQ(path.index_name, "orders_customer_created");
+    ASSERT_EQ(path.range.equal_prefix.size(), 1u);
+    EXPECT_EQ(std::get<int64_t>(path.range.equal_prefix[0].value), 42);
+    EXPECT_EQ(path.index_conditions.size(), 1u);
+    EXPECT_NEAR(path.rows, 10, 0.01);
+}
+
+TEST_F(AccessPathTest, CompositeKeyMatchesEqualityPrefixThenRange) {
+    AccessPath path = choose("o.customer_id = 42 AND o.created_at >= '2026-01-01' "
+                             "AND o.created_at > '2025-06-01' AND o.created_at < '2026-02-01' AND o.note = 'x'");
+    EXPECT_EQ(path.index_name, "orders_customer_created");
+    ASSERT_EQ(path.range.equal_prefix.size(), 1u);
+    ASSERT_TRUE(path.range.lower.has_value());
+    EXPECT_EQ(std::get<SQLDate>(path.range.lower->value).year, 2026);
+    EXPECT_TRUE(path.range.lower->inclusive);
+    ASSERT_TRUE(path.range.upper.has_value());
+    EXPECT_FALSE(path.range.upper->inclusive);
+    EXPECT_EQ(path.index_conditions.size(), 4u);
+    EXPECT_EQ(path.filter_conditions.size(), 1u);
+}
+
+TEST_F(AccessPathTest, IncomparableBoundStaysAFilter) {
+    AccessPath path = choose("o.customer_id = 42 AND o.created_at > 5 AND o.created_at > 'x'");
+    EXPECT_EQ(path.index_name, "orders_customer_created");
+    ASSERT_TRUE(path.range.lower.has_value());
+    EXPECT_EQ(std::get<int64_t>(path.range.lower->value), 5);
+    EXPECT_EQ(path.index_conditions.size(), 2u);
+    EXPECT_EQ(path.filter_conditions.size(), 1u);
+}
+
+TEST_F(AccessPathTest, NonLeadingKeyColumnCannotUseIndex) {
+    AccessPath path = choose("o.created_at >= '2026-01-01'", {indexes[0]});
+    EXPECT_EQ(path.method, AccessMethod::SEQ_SCAN);
+}
+
+TEST_F(AccessPathTest, ModerateRangeUsesBitmapHeapScan) {
+    AccessPath path = choose("o.amount < 20");
+    EXPECT_EQ(path.method, AccessMethod::BITMAP_HEAP_SCAN);
+    EXPECT_EQ(path.index_name, "orders_amount");
+    EXPECT_NEAR(path.rows, 20'000, 2'000);
+}
+
+TEST_F(AccessPathTest, UnselectiveRangeScansTable) {
+    AccessPath path = choose("100 < o.amount");
+    EXPECT_EQ(path.method, AccessMethod::SEQ_SCAN);
+    EXPECT_NEAR(path.rows, 900'000, 10'000);
+}
+
+TEST_F(AccessPathTest, BothBoundsDescribeOneRange) {
+    AccessPath path = choose("o.amount >= 500 AND o.amount < 510");
+    EXPECT_EQ(path.index_name, "orders_amount");
+    EXPECT_NEAR(path.rows, 10'000, 2'000);
+}
+
+TEST_F(AccessPathTest, OtherTablesConditionsAreIgnored) {
+    AccessPath path = choose("c.customer_id = 42 AND o.customer_id = c.id");
+    EXPECT_EQ(path.method, AccessMethod::SEQ_SCAN);
+    EXPECT_TRUE(path.filter_conditions.empty());
+    EXPECT_DOUBLE_EQ(path.rows, 1'000'000);
+}
+
+TEST(CostModelAccessTest, BitmapScanApproachesSequentialScanWhenDense) {
+    double rows = 1'000'000;
+    EXPECT_LT(index_scan_cost(rows, 1), bitmap_heap_scan_cost(rows, 1));
+    EXPECT_LT(bitmap_heap_scan_cost(rows, 10'000), index_scan_cost(rows, 10'000));
+    EXPECT_LT(seq_scan_cost(rows, 1), bitmap_heap_scan_cost(rows, rows));
+}
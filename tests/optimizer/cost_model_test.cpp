@@ -0,0 +1,26 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "optimizer/cost_model.h"
+
+#include <gtest/gtest.h>
+
+using namespace minidb;
+
+TEST(CostModelTest, SmallOuterWithIndexUsesIndexNestedLoopJoin) {
+    EXPECT_EQ(choose_join_algorithm(100, 10'000'000, true), JoinAlgorithm::INDEX_NESTED_LOOP_JOIN);
+}
+
+TEST(CostModelTest, LargeOuterUsesHashJoin) {
+    EXPECT_EQ(choose_join_algorithm(1'000'000, 10'000'000, true), JoinAlgorithm::HASH_JOIN);
+}
+
+TEST(CostModelTest, NoIndexAlwaysUsesHashJoin) {
+    EXPECT_EQ(choose_join_algorithm(1, 10'000'000, false), JoinAlgorithm::HASH_JOIN);
+}
+
+TEST(CostModelTest, IndexJoinCostIsCappedByReadingAllLeaves) {
+    double inner = 100'000;
+    EXPECT_LE(index_nested_loop_join_cost(1e9, inner), estimate_pages(inner) * RANDOM_PAGE_COST + 1e9 * CPU_TUPLE_COST);
+}
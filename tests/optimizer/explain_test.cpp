@@ -0,0 +1,104 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "optimizer/explain.h"
+
+#include <gtest/gtest.h>
+#include "test_utils.h"
+
+using namespace minidb;
+
+class ExplainTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        register_table(catalog, "orders", 1'000'000, {"customer_id"});
+        register_table(catalog, "customers", 10'000, {"id"});
+        indexes["orders"] = {{"orders_customer", {"customer_id"}}};
+        indexes["customers"] = {{"customers_pkey", {"id"}}};
+
+        ColumnStatistics customer_id;
+        customer_id.distinct_count = 100'000;
+        catalog.store_analysis("orders", 1'000'000, {{"customer_id", customer_id}});
+    }
+
+    SelectStatementNode &parse(const std::string &query) {
+        auto &statement = parse_statement_as<ExplainStatementNode>(query, ast);
+        return *dynamic_cast<SelectStatementNode *>(statement.statement.get());
+    }
+
+    std::unique_ptr<ExplainNode> explain(const std::string &query) {
+        return explain_select(parse(query), catalog, indexes);
+    }
+
+    StatisticsCatalog catalog;
+    IndexCatalog indexes;
+    std::unique_ptr<ASTNode> ast;
+};
+
+TEST_F(ExplainTest, ShowsAccessPathAndEstimates) {
+    auto plan = explain("EXPLAIN SELECT * FROM orders WHERE customer_id = 7 AND status = 'open';");
+    EXPECT_EQ(plan->title, "Index Scan using orders_customer on orders");
+    ASSERT_EQ(plan->details.size(), 2u);
+    EXPECT_EQ(plan->details[0], "Index Cond: (customer_id = 7)");
+    EXPECT_EQ(plan->details[1], "Filter: (status = 'open')");
+    EXPECT_TRUE(plan->children.empty());
+
+    std::string text = format_explain(*plan, false);
+    EXPECT_EQ(text.find("Index Scan using orders_customer on orders  (cost="), 0u) << text;
+    EXPECT_NE(text.find("rows=1)"), std::string::npos) << text;
+    EXPECT_EQ(text.find("actual"), std::string::npos);
+}
+
+TEST_F(ExplainTest, ShowsJoinTreeWithAggregateAndSort) {
+    SelectStatementNode &select = parse("EXPLAIN SELECT c.region, COUNT(*) FROM orders o "
+                                        "JOIN customers c ON o.customer_id = c.id "
+                                        "WHERE c.region = 'west' GROUP BY c.region;");
+    SelectStatementNode::OrderByClause order_by;
+    order_by.expression = std::make_unique<QualifiedIdentifierNode>(std::make_unique<IdentifierNode>("c"),
+                                                                    std::make_unique<IdentifierNode>("region"));
+    order_by.is_ascending = false;
+    select.order_by.push_back(std::move(order_by));
+
+    auto plan = explain_select(select, catalog, indexes);
+    EXPECT_EQ(plan->title, "Sort");
+    EXPECT_EQ(plan->details[0], "Sort Key: c.region DESC");
+    const ExplainNode &aggregate = *plan->children[0];
+    EXPECT_EQ(aggregate.title, "Aggregate");
+    EXPECT_EQ(aggregate.details[0], "Group Key: c.region");
+    const ExplainNode &join = *aggregate.children[0];
+    ASSERT_EQ(join.children.size(), 2u);
+    EXPECT_EQ(join.details[0], "Join Cond: (o.customer_id = c.id)");
+    // The filtered customers drive the join.
+    EXPECT_EQ(join.children[0]->title, "Seq Scan on customers c");
+    EXPECT_GE(plan->estimated_cost, join.estimated_cost);
+
+    std::string text = format_explain(*plan, false);
+    EXPECT_NE(text.find("\n  ->  Aggregate"), std::string::npos) << text;
+    EXPECT_NE(text.find("\n        ->  "), std::string::npos) << text;
+}
+
+TEST_F(ExplainTest, AnalyzeReportsActualStatistics) {
+    auto plan = explain("EXPLAIN ANALYZE SELECT * FROM orders;");
+    plan->actual.rows = 1'000'000;
+    plan->actual.batches = 977;
+    plan->actual.wall_time = std::chrono::microseconds(12'500);
+    plan->actual.cpu_time = std::chrono::microseconds(12'000);
+    plan->actual.pages_read = 15'000;
+    plan->actual.pages_hit = 625;
+    plan->actual.allocate(2048);
+
+    std::string text = format_explain(*plan, true);
+    EXPECT_NE(text.find("(actual rows=1000000 batches=977 wall=12.500 ms cpu=12.000 ms)"), std::string::npos) << text;
+    EXPECT_NE(text.find("Pages: read=15000 hit=625  Memory: 2.0 kB"), std::string::npos) << text;
+}
+
+TEST_F(ExplainTest, AnalyzeOmitsPageAndMemoryStatisticsNobodyReported) {
+    auto plan = explain("EXPLAIN ANALYZE SELECT * FROM orders;");
+    plan->actual.rows = 10;
+    plan->actual.batches = 1;
+
+    std::string text = format_explain(*plan, true);
+    EXPECT_NE(text.find("(actual rows=10 batches=1"), std::string::npos) << text;
+    EXPECT_EQ(text.find("Pages:"), std::string::npos) << text;
+}
@@ -0,0 +1,158 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "optimizer/join_order.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include "optimizer/selectivity.h"
+#include "test_utils.h"
+
+using namespace minidb;
+
+namespace {
+
+    // Checks that the plan is a join tree over exactly the graph's relations.
+    uint64_t covered_relations(const JoinPlan &plan) {
+        if (plan.is_leaf()) {
+            return uint64_t{1} << plan.relation;
+        }
+        uint64_t left = covered_relations(*plan.left);
+        uint64_t right = covered_relations(*plan.right);
+        EXPECT_EQ(left & right, 0u);
+        EXPECT_EQ(left | right, plan.relations);
+        return left | right;
+    }
+
+    JoinGraph random_graph(size_t tables, std::mt19937_64 &rng) {
+        JoinGraph graph;
+        std::uniform_real_distribution<double> exponent(1, 7);
+        for (size_t i = 0; i < tables; i++) {
+            double rows = std::pow(10.0, exponent(rng));
+            graph.relations.push_back({"t" + std::to_string(i), "", rows, rows});
+        }
+        for (size_t i = 1; i < tables; i++) {
+            size_t other = std::uniform_int_distribution<size_t>(0, i - 1)(rng);
+            JoinPredicate predicate{other, i, "id", "id"};
+            predicate.selectivity = 1.0 / std::max(graph.relations[other].rows, graph.relations[i].rows);
+            predicate.right_indexed = rng() % 2 == 0;
+            graph.predicates.push_back(predicate);
+        }
+        return graph;
+    }
+
+} // namespace
+
+class JoinOrderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // A fact table with three dimensions; the dimensions' keys are indexed.
+        register_table(catalog, "sales", 10'000'000, {});
+        register_table(catalog, "customers", 1'000'000, {"id"});
+        register_table(catalog, "products", 10'000, {"id"});
+        register_table(catalog, "stores", 100, {"id"});
+
+        ColumnStatistics state;
+        state.distinct_count = 50;
+        catalog.store_analysis("stores", 100, {{"state", state}});
+    }
+
+    JoinGraph graph_of(const std::string &query) {
+        return build_join_graph(parse_statement_as<SelectStatementNode>(query, ast), catalog);
+    }
+
+    StatisticsCatalog catalog;
+    std::unique_ptr<ASTNode> ast;
+};
+
+TEST_F(JoinOrderTest, BuildsGraphFromJoinsAndFilters) {
+    JoinGraph graph = graph_of("SELECT s.amount FROM sales s "
+                               "JOIN customers c ON s.customer_id = c.id "
+                               "JOIN stores st ON s.store_id = st.id "
+                               "WHERE st.state = 'CA' AND s.amount > 100;");
+
+    ASSERT_EQ(graph.relations.size(), 3u);
+    EXPECT_EQ(graph.relations[2].alias, "st");
+    EXPECT_DOUBLE_EQ(graph.relations[2].table_rows, 100);
+    // 50 distinct states.
+    EXPECT_DOUBLE_EQ(graph.relations[2].rows, 2);
+    EXPECT_DOUBLE_EQ(graph.relations[0].rows, 10'000'000 * DEFAULT_RANGE_SELECTIVITY);
+
+    ASSERT_EQ(graph.predicates.size(), 2u);
+    EXPECT_EQ(graph.predicates[0].left, 0u);
+    EXPECT_EQ(graph.predicates[0].right, 1u);
+    EXPECT_DOUBLE_EQ(graph.predicates[0].selectivity, 1.0 / 10'000'000);
+    EXPECT_FALSE(graph.predicates[0].left_indexed);
+    EXPECT_TRUE(graph.predicates[0].right_indexed);
+}
+
+TEST_F(JoinOrderTest, StartsFromTheMostSelectiveDimension) {
+    JoinGraph graph = graph_of("SELECT s.amount FROM sales s "
+                               "JOIN customers c ON s.customer_id = c.id "
+                               "JOIN products p ON s.product_id = p.id "
+                               "JOIN stores st ON s.store_id = st.id "
+                               "WHERE st.state = 'CA';");
+    auto plan = optimize_join_order(graph);
+    ASSERT_NE(plan, nullptr);
+    EXPECT_EQ(covered_relations(*plan), 0b1111u);
+
+    // The filtered stores are joined with sales before the large dimensions.
+    const JoinPlan *node = plan.get();
+    while (!node->left->is_leaf()) node = node->left.get();
+    uint64_t first_join = node->relations;
+    EXPECT_EQ(first_join, 0b1001u) << plan->to_string(graph);
+}
+
+TEST_F(JoinOrderTest, SmallOuterProbesIndexedInner) {
+    JoinGraph graph = graph_of("SELECT c.name FROM stores st JOIN customers c ON st.manager_id = c.id "
+                               "WHERE st.state = 'CA';");
+    auto plan = optimize_join_order(graph);
+    EXPECT_EQ(plan->to_string(graph), "INDEX_NESTED_LOOP_JOIN(st, c)");
+}
+
+TEST_F(JoinOrderTest, UnconnectedTablesAreJoinedByCrossProduct) {
+    JoinGraph graph = graph_of("SELECT * FROM stores a JOIN stores b ON a.id = b.id JOIN products p ON p.id = p.id;");
+    auto plan = optimize_join_order(graph);
+    ASSERT_NE(plan, nullptr);
+    EXPECT_EQ(covered_relations(*plan), 0b111u);
+    EXPECT_DOUBLE_EQ(plan->rows, 100 * 10'000);
+}
+
+TEST(JoinOrderSearchTest, DynamicProgrammingIsNeverWorseThanGreedy) {
+    std::mt19937_64 rng(42);
+    for (int trial = 0; trial < 50; trial++) {
+        JoinGraph graph = random_graph(2 + trial % 7, rng);
+        auto exhaustive = optimize_join_order(graph);
+        auto greedy = optimize_join_order(graph, 0);
+        EXPECT_EQ(covered_relations(*exhaustive), covered_relations(*greedy));
+        EXPECT_LE(exhaustive->cost, greedy->cost * (1 + 1e-9));
+    }
+}
+
+TEST(JoinOrderSearchTest, LargeQueriesFallBackToGreedy) {
+    std::mt19937_64 rng(7);
+    JoinGraph graph = random_graph(40, rng);
+    auto start = std::chrono::steady_clock::now();
+    auto plan = optimize_join_order(graph);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(covered_relations(*plan), (uint64_t{1} << 40) - 1);
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+}
+
+TEST(SelectivityTest, UsesStatisticsWhenAvailable) {
+    ColumnStatisticsBuilder builder;
+    for (int64_t i = 0; i < 1000; i++) builder.add(LiteralValue{i});
+    ColumnStatistics statistics = builder.build(1000);
+
+    EXPECT_NEAR(comparison_selectivity(&statistics, "<", LiteralValue{int64_t{250}}), 0.25, 0.02);
+    EXPECT_NEAR(comparison_selectivity(&statistics, ">=", LiteralValue{int64_t{250}}), 0.75, 0.02);
+    EXPECT_NEAR(comparison_selectivity(&statistics, "=", LiteralValue{int64_t{7}}), 0.001, 0.0002);
+    EXPECT_DOUBLE_EQ(comparison_selectivity(nullptr, "<", LiteralValue{int64_t{7}}), DEFAULT_RANGE_SELECTIVITY);
+    // A parameter's value is unknown: equality is 1 / distinct values.
+    EXPECT_NEAR(parameter_selectivity(&statistics, "="), 0.001, 0.0002);
+    EXPECT_DOUBLE_EQ(parameter_selectivity(&statistics, ">"), DEFAULT_RANGE_SELECTIVITY);
+    EXPECT_EQ(commute_comparison("<="), ">=");
+    EXPECT_DOUBLE_EQ(equi_join_selectivity(10, 1000), 0.001);
+}
@@ -0,0 +1,71 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "optimizer/metadata_aggregate.h"
+
+#include <gtest/gtest.h>
+#include "test_utils.h"
+
+using namespace minidb;
+
+class MetadataAggregateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        catalog.register_table("orders", {"id"});
+        StatisticsDelta delta;
+        for (int64_t id : {10, 20, 30}) {
+            delta.add_rows("orders", 1);
+            delta.insert_value("orders", "id", id);
+        }
+        catalog.commit(delta);
+    }
+
+    std::optional<std::vector<MetadataAggregate>> plan(const std::string &query) {
+        return plan_metadata_aggregates(parse_statement_as<SelectStatementNode>(query, ast), catalog);
+    }
+
+    StatisticsCatalog catalog;
+    std::unique_ptr<ASTNode> ast;
+};
+
+TEST_F(MetadataAggregateTest, CountStarComesFromRowCount) {
+    auto result = plan("SELECT COUNT(*) FROM orders;");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1u);
+    EXPECT_EQ((*result)[0].function, MetadataAggregate::Function::COUNT_STAR);
+    EXPECT_EQ((*result)[0].source, AggregateSource::TABLE_METADATA);
+    EXPECT_EQ(std::get<int64_t>(*(*result)[0].value), 3);
+}
+
+TEST_F(MetadataAggregateTest, MinMaxOfIndexedColumn) {
+    auto result = plan("SELECT min(id), MAX(id), count(*) FROM orders;");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 3u);
+    EXPECT_EQ(std::get<int64_t>(*(*result)[0].value), 10);
+    EXPECT_EQ(std::get<int64_t>(*(*result)[1].value), 30);
+    EXPECT_EQ((*result)[1].column, "id");
+}
+
+TEST_F(MetadataAggregateTest, InexactBoundUsesIndexEndpoint) {
+    StatisticsDelta delta;
+    delta.remove_rows("orders", 1);
+    delta.delete_value("orders", "id", int64_t{30});
+    catalog.commit(delta);
+
+    auto result = plan("SELECT MIN(id), MAX(id) FROM orders;");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ((*result)[0].source, AggregateSource::TABLE_METADATA);
+    EXPECT_EQ((*result)[1].source, AggregateSource::INDEX_ENDPOINT);
+    EXPECT_FALSE((*result)[1].value.has_value());
+}
+
+TEST_F(MetadataAggregateTest, QueriesThatNeedAScan) {
+    EXPECT_FALSE(plan("SELECT COUNT(*) FROM orders WHERE id > 10;").has_value());
+    EXPECT_FALSE(plan("SELECT MAX(total) FROM orders;").has_value());
+    EXPECT_FALSE(plan("SELECT SUM(id) FROM orders;").has_value());
+    EXPECT_FALSE(plan("SELECT COUNT(id) FROM orders;").has_value());
+    EXPECT_FALSE(plan("SELECT id, COUNT(*) FROM orders GROUP BY id;").has_value());
+    EXPECT_FALSE(plan("SELECT COUNT(*) FROM unknown;").has_value());
+    EXPECT_FALSE(plan("SELECT * FROM orders;").has_value());
+}
@@ -0,0 +1,130 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "optimizer/plan_cache.h"
+
+#include <gtest/gtest.h>
+#include "sql/parameters.h"
+#include "test_utils.h"
+
+using namespace minidb;
+
+class PlanCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        register_table(catalog, "orders", 1'000'000, {"customer_id"});
+        indexes["orders"] = {{"orders_customer", {"customer_id"}}};
+
+        ColumnStatistics customer_id;
+        customer_id.distinct_count = 100'000;
+        catalog.store_analysis("orders", 1'000'000, {{"customer_id", customer_id}});
+    }
+
+    StatisticsCatalog catalog;
+    IndexCatalog indexes;
+};
+
+TEST_F(PlanCacheTest, ReusesPlanForSameText) {
+    PlanCache cache(catalog, indexes);
+    const std::string query = "SELECT * FROM orders WHERE customer_id = ?;";
+    auto first = cache.get(query);
+    auto second = cache.get(query);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->parameter_count, 1u);
+
+    // The generic plan still uses the index: one customer out of 100,000.
+    ASSERT_NE(first->plan, nullptr);
+    EXPECT_EQ(first->plan->title, "Index Scan using orders_customer on orders");
+    EXPECT_EQ(first->plan->details[0], "Index Cond: (customer_id = $1)");
+
+    PlanCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST_F(PlanCacheTest, ReplansAfterStatisticsOrSchemaChange) {
+    PlanCache cache(catalog, indexes);
+    const std::string query = "SELECT * FROM orders WHERE customer_id = $1;";
+    auto planned = cache.get(query);
+
+    // Now every order belongs to one of two customers: the index no longer pays off.
+    ColumnStatistics customer_id;
+    customer_id.distinct_count = 2;
+    catalog.store_analysis("orders", 1'000'000, {{"customer_id", customer_id}});
+    auto replanned = cache.get(query);
+    EXPECT_NE(planned, replanned);
+    EXPECT_EQ(replanned->plan->title, "Seq Scan on orders");
+    // The statement is not parsed again.
+    EXPECT_EQ(planned->statement, replanned->statement);
+
+    indexes["orders"].push_back({"orders_customer_total", {"customer_id", "total"}});
+    catalog.invalidate_plans("orders");
+    EXPECT_NE(cache.get(query), replanned);
+
+    // Ordinary writes do not invalidate plans.
+    auto current = cache.get(query);
+    StatisticsDelta delta;
+    delta.add_rows("orders", 10);
+    catalog.commit(delta);
+    EXPECT_EQ(cache.get(query), current);
+
+    PlanCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.replans, 2u);
+    EXPECT_EQ(stats.hits, 2u);
+}
+
+TEST_F(PlanCacheTest, EvictsLeastRecentlyUsed) {
+    PlanCache cache(catalog, indexes, 2);
+    auto a = cache.get("SELECT * FROM orders WHERE id = 1;");
+    cache.get("SELECT * FROM orders WHERE id = 2;");
+    EXPECT_EQ(cache.get("SELECT * FROM orders WHERE id = 1;"), a);
+    cache.get("SELECT * FROM orders WHERE id = 3;");
+
+    EXPECT_EQ(cache.get("SELECT * FROM orders WHERE id = 1;"), a);
+    PlanCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.hits, 2u);
+
+    cache.get("SELECT * FROM orders WHERE id = 2;");
+    EXPECT_EQ(cache.stats().misses, 4u);
+}
+
+TEST_F(PlanCacheTest, NamedStatements) {
+    PlanCache cache(catalog, indexes, 1);
+    auto prepare = parse_statement("PREPARE add_order AS INSERT INTO orders (id, customer_id) VALUES ($1, $2);");
+    cache.prepare(*dynamic_cast<PrepareStatementNode *>(prepare.get()));
+
+    // Named statements are not subject to the LRU bound.
+    cache.get("SELECT * FROM orders;");
+    cache.get("SELECT id FROM orders;");
+
+    auto execute = parse_statement("EXECUTE ADD_ORDER (7, 42);");
+    auto &arguments = *dynamic_cast<ExecuteStatementNode *>(execute.get());
+    auto prepared = cache.named(arguments.name->name);
+    EXPECT_EQ(prepared->plan, nullptr);
+    ParameterValues values = execute_arguments(arguments, prepared->parameter_count);
+
+    auto &insert = dynamic_cast<const InsertStatementNode &>(*prepared->statement);
+    auto rows = bind_insert_values(insert, values);
+    ASSERT_EQ(rows.row_count(), 1u);
+    EXPECT_EQ(std::get<int64_t>(rows.value(0, 0)), 7);
+    EXPECT_EQ(std::get<int64_t>(rows.value(0, 1)), 42);
+
+    auto too_few = parse_statement("EXECUTE add_order (7);");
+    EXPECT_THROW(execute_arguments(*dynamic_cast<ExecuteStatementNode *>(too_few.get()), prepared->parameter_count),
+                 std::runtime_error);
+
+    cache.deallocate("add_order");
+    EXPECT_THROW(cache.named("add_order"), std::runtime_error);
+}
+
+TEST_F(PlanCacheTest, RejectsStatementsThatCannotBePrepared) {
+    PlanCache cache(catalog, indexes);
+    EXPECT_THROW(cache.get("DROP TABLE orders;"), std::runtime_error);
+    EXPECT_THROW(cache.get("SELECT * FROM"), std::runtime_error);
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
@@ -0,0 +1,20 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#pragma once
+
+#include "../sql/test_utils.h"
+#include "catalog/table_statistics.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Registers a table holding rows rows, with an index on each of the indexed columns.
+inline void register_table(StatisticsCatalog& catalog, const std::string& table, int64_t rows,
+                           const std::vector<std::string>& indexed) {
+    catalog.register_table(table, indexed);
+    StatisticsDelta delta;
+    delta.add_rows(table, rows);
+    catalog.commit(delta);
+}
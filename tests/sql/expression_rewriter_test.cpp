@@ -0,0 +1,170 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "sql/expression_rewriter.h"
+
+#include <gtest/gtest.h>
+#include "sql/lexer.h"
+#include "sql/parser.h"
+
+using namespace minidb;
+
+class ExpressionRewriterTest : public ::testing::Test {
+protected:
+    // Parses "SELECT x FROM t WHERE <condition>" and returns the WHERE expression.
+    std::unique_ptr<ExpressionNode> where(const std::string &condition) {
+        std::string query = "SELECT x FROM t WHERE " + condition;
+        Lexer lexer(query);
+        Parser parser(lexer.tokenize());
+        auto ast = parser.parse();
+        auto *select = dynamic_cast<SelectStatementNode *>(ast.get());
+        return std::move(select->where_clause);
+    }
+
+    std::unique_ptr<ExpressionNode> rewrite(const std::string &condition) {
+        return rewriter.rewrite(where(condition));
+    }
+
+    void expect_same(const std::unique_ptr<ExpressionNode> &actual, const std::string &expected_condition) {
+        auto expected = where(expected_condition);
+        ASSERT_NE(actual, nullptr);
+        EXPECT_TRUE(expressions_equal(*actual, *expected)) << "expected " << expected_condition;
+    }
+
+    static const LiteralValue &literal(const std::unique_ptr<ExpressionNode> &expression) {
+        auto *node = dynamic_cast<LiteralNode *>(expression.get());
+        EXPECT_NE(node, nullptr);
+        return node->value;
+    }
+
+    ExpressionRewriter rewriter;
+};
+
+TEST_F(ExpressionRewriterTest, FoldsIntegerArithmetic) {
+    auto result = rewrite("x = 1 + 2 - 4");
+    auto *eq = dynamic_cast<BinaryOperationNode *>(result.get());
+    EXPECT_EQ(std::get<int64_t>(literal(eq->right)), -1);
+}
+
+TEST_F(ExpressionRewriterTest, FoldsMixedArithmeticToDouble) {
+    auto result = rewrite("x > 1 + 0.5");
+    auto *gt = dynamic_cast<BinaryOperationNode *>(result.get());
+    EXPECT_DOUBLE_EQ(std::get<double>(literal(gt->right)), 1.5);
+}
+
+TEST_F(ExpressionRewriterTest, DoesNotFoldOverflow) {
+    auto result = rewrite("x = 9223372036854775807 + 1");
+    auto *eq = dynamic_cast<BinaryOperationNode *>(result.get());
+    EXPECT_NE(dynamic_cast<BinaryOperationNode *>(eq->right.get()), nullptr);
+}
+
+TEST_F(ExpressionRewriterTest, FoldsComparisonsOfLiterals) {
+    EXPECT_TRUE(std::get<bool>(literal(rewrite("2 > 1"))));
+    EXPECT_FALSE(std::get<bool>(literal(rewrite("'abc' = 'abd'"))));
+    EXPECT_TRUE(std::get<bool>(literal(rewrite("'2024-01-01' < '2024-02-01'"))));
+    EXPECT_TRUE(std::get<bool>(literal(rewrite("1 = 1.0"))));
+}
+
+TEST_F(ExpressionRewriterTest, LeavesMismatchedTypesAlone) {
+    auto result = rewrite("1 = 'one'");
+    EXPECT_NE(dynamic_cast<BinaryOperationNode *>(result.get()), nullptr);
+    EXPECT_EQ(rewriter.rewrite_count(), 0);
+}
+
+TEST_F(ExpressionRewriterTest, RemovesAdditiveIdentities) {
+    ExpressionRewriter typed([](const ExpressionNode &column) -> std::optional<ValueType> {
+        const std::string &name = dynamic_cast<const IdentifierNode &>(column).name;
+        if (name == "price") return ValueType::FLOAT;
+        if (name == "name") return ValueType::STRING;
+        return ValueType::INT;
+    });
+    expect_same(typed.rewrite(where("a + 0 = b")), "a = b");
+    expect_same(typed.rewrite(where("0 + a = b - 0")), "a = b");
+    expect_same(typed.rewrite(where("0 - a = b")), "0 - a = b");
+    expect_same(typed.rewrite(where("price + 0 = price - 0.0")), "price = price");
+
+    // The zero would have promoted an integer to a double, or hidden a type error.
+    expect_same(typed.rewrite(where("a + 0.0 = b")), "a + 0.0 = b");
+    expect_same(typed.rewrite(where("name + 0 = b")), "name + 0 = b");
+    EXPECT_EQ(typed.rewrite_count(), 5);
+
+    // Without column types nothing is known about 'a'.
+    expect_same(rewrite("a + 0 = b"), "a + 0 = b");
+    EXPECT_EQ(rewriter.rewrite_count(), 0);
+}
+
+TEST_F(ExpressionRewriterTest, SimplifiesBooleanIdentities) {
+    expect_same(rewrite("x = 1 AND TRUE"), "x = 1");
+    expect_same(rewrite("FALSE OR x = 1"), "x = 1");
+    EXPECT_FALSE(std::get<bool>(literal(rewrite("x = 1 AND FALSE"))));
+    EXPECT_TRUE(std::get<bool>(literal(rewrite("TRUE OR x = 1"))));
+    // 1 = 1 folds to TRUE first, then AND TRUE disappears.
+    expect_same(rewrite("1 = 1 AND y < 3"), "y < 3");
+}
+
+TEST_F(ExpressionRewriterTest, RemovesDuplicateConjuncts) {
+    expect_same(rewrite("x = 1 AND x = 1"), "x = 1");
+    expect_same(rewrite("x = 1 AND y = 2 AND x = 1 AND (y = 2 AND z = 3)"), "x = 1 AND y = 2 AND z = 3");
+    expect_same(rewrite("x = 1 or y = 2 OR x = 1"), "x = 1 OR y = 2");
+    EXPECT_EQ(rewriter.rewrite_count(), 4);
+}
+
+TEST_F(ExpressionRewriterTest, KeepsDistinctConjuncts) {
+    expect_same(rewrite("x = 1 AND x = 2"), "x = 1 AND x = 2");
+    expect_same(rewrite("t.x = 1 AND u.x = 1"), "t.x = 1 AND u.x = 1");
+    EXPECT_EQ(rewriter.rewrite_count(), 0);
+}
+
+TEST_F(ExpressionRewriterTest, RewritesWholeStatements) {
+    Lexer lexer("UPDATE counters SET hits = hits + 0, total = 10 + 5 WHERE id = 3 AND 1 = 1;");
+    Parser parser(lexer.tokenize());
+    auto ast = parser.parse();
+    ExpressionRewriter typed([](const ExpressionNode &) { return std::optional<ValueType>(ValueType::INT); });
+    typed.rewrite_statement(*ast);
+
+    auto *update = dynamic_cast<UpdateStatementNode *>(ast.get());
+    ASSERT_NE(update, nullptr);
+    EXPECT_EQ(dynamic_cast<IdentifierNode *>(update->updates[0].value.get())->name, "hits");
+    EXPECT_EQ(std::get<int64_t>(literal(update->updates[1].value)), 15);
+    expect_same(update->where_clause, "id = 3");
+}
+
+TEST_F(ExpressionRewriterTest, AlwaysTrueWhereClauseIsDropped) {
+    Lexer lexer("DELETE FROM t WHERE 1 = 1 OR x = 2;");
+    Parser parser(lexer.tokenize());
+    auto ast = parser.parse();
+    rewriter.rewrite_statement(*ast);
+
+    EXPECT_EQ(dynamic_cast<DeleteStatementNode *>(ast.get())->where_clause, nullptr);
+}
+
+TEST_F(ExpressionRewriterTest, FindsCommonSubexpressions) {
+    auto expression = where("(a + b > 1 AND c = 2) OR (a + b > 1 AND d = 3) OR a + b < 0");
+    auto common = find_common_subexpressions(*expression);
+
+    // 'a + b > 1' occurs twice; 'a + b' occurs a third time inside 'a + b < 0'.
+    ASSERT_EQ(common.size(), 2);
+    EXPECT_TRUE(expressions_equal(*common[0], *where("a + b > 1")));
+    auto *plus = dynamic_cast<const BinaryOperationNode *>(common[1]);
+    ASSERT_NE(plus, nullptr);
+    EXPECT_EQ(plus->op, "+");
+}
+
+TEST_F(ExpressionRewriterTest, HashIsConsistentWithEquality) {
+    EXPECT_EQ(expression_hash(*where("a + 1 = b and c")), expression_hash(*where("a + 1 = b AND c")));
+    EXPECT_NE(expression_hash(*where("a + 1 = b")), expression_hash(*where("a + 2 = b")));
+}
+
+TEST_F(ExpressionRewriterTest, SplitsConjuncts) {
+    auto expression = where("a = 1 AND (b = 2 OR c = 3) AND (d < 4 AND e > 5)");
+    auto conjuncts = split_conjuncts(expression.get());
+    ASSERT_EQ(conjuncts.size(), 4);
+    EXPECT_TRUE(expressions_equal(*conjuncts[1], *where("b = 2 OR c = 3")));
+    EXPECT_TRUE(split_conjuncts(nullptr).empty());
+}
+
+TEST_F(ExpressionRewriterTest, RendersExpressionsAsSql) {
+    EXPECT_EQ(expression_to_string(*where("t.a = 'west' AND b >= 2.5 OR MAX(c) < '2026-01-31'")),
+              "(((t.a = 'west') AND (b >= 2.5)) OR (MAX(c) < '2026-01-31'))");
+}
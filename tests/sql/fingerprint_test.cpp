@@ -0,0 +1,42 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "sql/fingerprint.h"
+
+#include <gtest/gtest.h>
+#include "sql/lexer.h"
+#include "sql/parser.h"
+
+using namespace minidb;
+
+namespace {
+
+    std::string fingerprint(const std::string &query) {
+        Lexer lexer(query);
+        return statement_fingerprint(lexer.tokenize());
+    }
+
+} // namespace
+
+TEST(FingerprintTest, IgnoresWhitespaceCaseAndSemicolon) {
+    EXPECT_EQ(fingerprint("select  Name from USERS where id = 7;"), "SELECT name FROM users WHERE id = 7");
+    EXPECT_EQ(fingerprint("SELECT name\nFROM users\tWHERE ID=7"), fingerprint("select NAME from Users where id = 7;"));
+}
+
+TEST(FingerprintTest, LiteralsAreSignificant) {
+    EXPECT_NE(fingerprint("SELECT a FROM t WHERE id = 7"), fingerprint("SELECT a FROM t WHERE id = 8"));
+    EXPECT_NE(fingerprint("SELECT a FROM t WHERE s = 'Abc'"), fingerprint("SELECT a FROM t WHERE s = 'abc'"));
+    // A string literal never collides with an identifier of the same text.
+    EXPECT_NE(fingerprint("SELECT a FROM t WHERE s = 'b'"), fingerprint("SELECT a FROM t WHERE s = b"));
+    EXPECT_EQ(fingerprint("SELECT a FROM t WHERE s = 'it''s'"), "SELECT a FROM t WHERE s = 'it''s'");
+}
+
+TEST(FingerprintTest, ReferencedTablesAreDeduplicated) {
+    std::string query = "SELECT u.id FROM Users u JOIN orders o ON u.id = o.user_id";
+    Lexer lexer(query);
+    Parser parser(lexer.tokenize());
+    auto ast = parser.parse();
+    auto tables = referenced_tables(*dynamic_cast<SelectStatementNode *>(ast.get()));
+    EXPECT_EQ(tables, (std::vector<std::string>{"users", "orders"}));
+}
@@ -4,6 +4,9 @@
 #include <gtest/gtest.h>
 #include "sql/lexer.h"
 #include "sql/token.h"
+#include "sql/token_source.h"
+#include "sql/token_type_utils.h"
+#include "sql/utils.h"
 #include "test_utils.h"
 #include <vector>
 
@@ -320,3 +323,121 @@ TEST_F(LexerTest, ComplexOperators) {
   };
   assert_tokens_equal(tokens, expected_tokens);
 }
+
+TEST_F(LexerTest, ParameterPlaceholders) {
+  std::string query = "WHERE a = ? AND b < $12 AND c = $;";
+  Lexer lexer(query);
+  std::vector<Token> tokens = lexer.tokenize();
+
+  std::vector<Token> expected_tokens = {
+	  {TokenType::WHERE, "WHERE"},
+	  {TokenType::IDENTIFIER, "a"},
+	  {TokenType::EQ, "="},
+	  {TokenType::PARAMETER, "?"},
+	  {TokenType::AND, "AND"},
+	  {TokenType::IDENTIFIER, "b"},
+	  {TokenType::LT, "<"},
+	  {TokenType::PARAMETER, "$12"},
+	  {TokenType::AND, "AND"},
+	  {TokenType::IDENTIFIER, "c"},
+	  {TokenType::EQ, "="},
+	  {TokenType::UNKNOWN, "$"},
+	  {TokenType::SEMICOLON, ";"},
+	  {TokenType::EOF_FILE, ""}
+  };
+  assert_tokens_equal(tokens, expected_tokens);
+}
+
+TEST_F(LexerTest, TokensViewTheInput) {
+  std::string query = "SELECT name FROM users WHERE note = 'it''s' AND id = 12345;";
+  Lexer lexer(query);
+  std::vector<Token> tokens = lexer.tokenize();
+
+  std::vector<Token> expected_tokens = {
+	  {TokenType::SELECT, "SELECT"},
+	  {TokenType::IDENTIFIER, "name"},
+	  {TokenType::FROM, "FROM"},
+	  {TokenType::IDENTIFIER, "users"},
+	  {TokenType::WHERE, "WHERE"},
+	  {TokenType::IDENTIFIER, "note"},
+	  {TokenType::EQ, "="},
+	  {TokenType::STRING_LITERAL, "it''s"},
+	  {TokenType::AND, "AND"},
+	  {TokenType::IDENTIFIER, "id"},
+	  {TokenType::EQ, "="},
+	  {TokenType::INT_LITERAL, "12345"},
+	  {TokenType::SEMICOLON, ";"},
+	  {TokenType::EOF_FILE, ""}
+  };
+  assert_tokens_equal(tokens, expected_tokens);
+  EXPECT_EQ(tokens[1].text.data(), query.data() + query.find("name"));
+  EXPECT_EQ(tokens[7].text.data(), query.data() + query.find("it''s"));
+  EXPECT_EQ(tokens[11].text.data(), query.data() + query.find("12345"));
+}
+
+TEST_F(LexerTest, KeywordsAreCaseInsensitiveAndExact) {
+  for (const auto &keyword : keywords::KEYWORDS) {
+	std::string upper(keyword.text);
+	std::string lower(upper);
+	for (char &c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+	std::string mixed(lower);
+	mixed[0] = upper[0];
+
+	for (const std::string &word : {upper, lower, mixed}) {
+	  Lexer lexer(word);
+	  Token token = lexer.next_token();
+	  EXPECT_EQ(token.type, keyword.type) << word;
+	  EXPECT_EQ(token.text, word);
+	}
+	for (const std::string &word : {upper + "S", "_" + lower, lower + "1"}) {
+	  Lexer lexer(word);
+	  EXPECT_EQ(lexer.next_token().type, TokenType::IDENTIFIER) << word;
+	}
+  }
+}
+
+TEST_F(LexerTest, DateAndTimestampShapes) {
+  std::optional<SQLTimestamp> ts = decode_timestamp_literal("2025-10-31 12:30:59");
+  ASSERT_TRUE(ts.has_value());
+  EXPECT_EQ(ts->year, 2025);
+  EXPECT_EQ(ts->day, 31);
+  EXPECT_EQ(ts->hour, 12);
+  EXPECT_EQ(ts->second, 59);
+  std::optional<SQLDate> date = decode_date_literal("0999-01-02");
+  ASSERT_TRUE(date.has_value());
+  EXPECT_EQ(date->year, 999);
+  EXPECT_EQ(date->month, 1);
+
+  // Anything that is not exactly YYYY-MM-DD or YYYY-MM-DD HH:MM:SS stays a string.
+  for (const char *text : {"2025-1-31", "2025-10-31x", "2025/10/31", "20a5-10-31", "2025-10-31 12:30",
+						   "2025-10-31T12:30:00", "2025-10-31 12:30:0a", " 2025-10-31"}) {
+	std::string query = std::string("'") + text + "'";
+	Lexer lexer(query);
+	EXPECT_EQ(lexer.next_token().type, TokenType::STRING_LITERAL) << text;
+  }
+}
+
+TEST_F(LexerTest, TokenSourceLookahead) {
+    std::string query = "SELECT a FROM t";
+    Lexer lexer(query);
+    TokenSource tokens(lexer);
+
+    EXPECT_EQ(tokens.peek().type, TokenType::SELECT);
+    EXPECT_EQ(tokens.peek(2).type, TokenType::FROM);
+    EXPECT_EQ(tokens.advance().text, "SELECT");
+    EXPECT_EQ(tokens.peek(TokenSource::LOOKAHEAD).text, "t");
+    tokens.advance();
+    EXPECT_EQ(tokens.previous().text, "a");
+    tokens.advance();
+    tokens.advance();
+    EXPECT_EQ(tokens.previous().text, "t");
+    EXPECT_FALSE(tokens.at_end());
+    EXPECT_EQ(tokens.advance().type, TokenType::EOF_FILE);
+    EXPECT_TRUE(tokens.at_end());
+    EXPECT_EQ(tokens.peek().type, TokenType::EOF_FILE);
+    EXPECT_THROW(tokens.advance(), std::out_of_range);
+
+    // A vector without a trailing EOF_FILE token still ends in one.
+    TokenSource vector_tokens(std::vector<Token>{{TokenType::IDENTIFIER, "x"}});
+    EXPECT_EQ(vector_tokens.peek(1).type, TokenType::EOF_FILE);
+}
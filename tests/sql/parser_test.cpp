@@ -9,6 +9,7 @@
 #include "sql/lexer.h"
 #include <vector>
 #include "sql/ast.h"
+#include "sql/parameters.h"
 
 using namespace minidb;
 
@@ -922,14 +923,12 @@ TEST_F(ParserTest, InsertWithFloatLiteral) {
     EXPECT_EQ(insertNode->columnNames[0]->name, "price");
 
     // Verify values
-    ASSERT_EQ(insertNode->values.size(), 1);
-    ASSERT_EQ(insertNode->values[0].size(), 1);
+    ASSERT_EQ(insertNode->values.row_count(), 1);
+    ASSERT_EQ(insertNode->values.column_count(), 1);
 
     // Verify the float literal
-    ASSERT_EQ(insertNode->values[0].size(), 1);
-    auto* literal = insertNode->values[0][0].get();
-    ASSERT_NE(literal, nullptr);
-    EXPECT_EQ(std::get<double>(literal->value), 99.99);
+    LiteralValue literal = insertNode->values.value(0, 0);
+    EXPECT_EQ(std::get<double>(literal), 99.99);
 }
 
 TEST_F(ParserTest, SelectWithFloatInWhereClause) {
@@ -1009,13 +1008,12 @@ TEST_F(ParserTest, InsertWithDateLiteral) {
     EXPECT_EQ(insertNode->columnNames[0]->name, "event_date");
 
     // Verify values
-    ASSERT_EQ(insertNode->values.size(), 1);
-    ASSERT_EQ(insertNode->values[0].size(), 1);
+    ASSERT_EQ(insertNode->values.row_count(), 1);
+    ASSERT_EQ(insertNode->values.column_count(), 1);
 
     // Verify the date literal
-    auto* literal = insertNode->values[0][0].get();
-    ASSERT_NE(literal, nullptr);
-    auto date = std::get<SQLDate>(literal->value);
+    LiteralValue literal = insertNode->values.value(0, 0);
+    auto date = std::get<SQLDate>(literal);
     EXPECT_EQ(date.year, 2025);
     EXPECT_EQ(date.month, 10);
     EXPECT_EQ(date.day, 31);
@@ -1036,13 +1034,12 @@ TEST_F(ParserTest, InsertWithTimestampLiteral) {
     EXPECT_EQ(insertNode->columnNames[0]->name, "log_time");
 
     // Verify values
-    ASSERT_EQ(insertNode->values.size(), 1);
-    ASSERT_EQ(insertNode->values[0].size(), 1);
+    ASSERT_EQ(insertNode->values.row_count(), 1);
+    ASSERT_EQ(insertNode->values.column_count(), 1);
 
     // Verify the timestamp literal
-    auto* literal = insertNode->values[0][0].get();
-    ASSERT_NE(literal, nullptr);
-    auto ts = std::get<SQLTimestamp>(literal->value);
+    LiteralValue literal = insertNode->values.value(0, 0);
+    auto ts = std::get<SQLTimestamp>(literal);
     EXPECT_EQ(ts.year, 2025);
     EXPECT_EQ(ts.month, 10);
     EXPECT_EQ(ts.day, 31);
@@ -1220,11 +1217,11 @@ TEST_F(ParserTest, SimpleInsertStatement) {
   ASSERT_NE(root, nullptr);
   ASSERT_EQ(root->tableName->name, "users");
   ASSERT_EQ(root->columnNames.size(), 0);
-  ASSERT_EQ(root->values.size(), 1);
-  ASSERT_EQ(root->values[0].size(), 3);
-  ASSERT_EQ(std::get<int64_t>(root->values[0][0]->value), 10);
-  ASSERT_EQ(std::get<std::string>(root->values[0][1]->value), "test");
-  ASSERT_EQ(std::get<bool>(root->values[0][2]->value), false);
+  ASSERT_EQ(root->values.row_count(), 1);
+  ASSERT_EQ(root->values.column_count(), 3);
+  ASSERT_EQ(std::get<int64_t>(root->values.value(0, 0)), 10);
+  ASSERT_EQ(std::get<std::string>(root->values.value(0, 1)), "test");
+  ASSERT_EQ(std::get<bool>(root->values.value(0, 2)), false);
 
 }
 
@@ -1239,11 +1236,11 @@ TEST_F(ParserTest, SimpleInsertStatementWithColumns) {
   ASSERT_EQ(root->columnNames[1]->name, "name");
   ASSERT_EQ(root->columnNames[2]->name, "isAlive");
 
-  ASSERT_EQ(root->values.size(), 1);
-  ASSERT_EQ(root->values[0].size(), 3);
-  ASSERT_EQ(std::get<int64_t>(root->values[0][0]->value), 10);
-  ASSERT_EQ(std::get<std::string>(root->values[0][1]->value), "test");
-  ASSERT_EQ(std::get<bool>(root->values[0][2]->value), false);
+  ASSERT_EQ(root->values.row_count(), 1);
+  ASSERT_EQ(root->values.column_count(), 3);
+  ASSERT_EQ(std::get<int64_t>(root->values.value(0, 0)), 10);
+  ASSERT_EQ(std::get<std::string>(root->values.value(0, 1)), "test");
+  ASSERT_EQ(std::get<bool>(root->values.value(0, 2)), false);
 }
 
 TEST_F(ParserTest, MultiInsertStatementWithColumns) {
@@ -1257,14 +1254,14 @@ TEST_F(ParserTest, MultiInsertStatementWithColumns) {
   ASSERT_EQ(root->columnNames[1]->name, "name");
   ASSERT_EQ(root->columnNames[2]->name, "isAlive");
 
-  ASSERT_EQ(root->values.size(), 2);
-  ASSERT_EQ(root->values[0].size(), 3);
-  ASSERT_EQ(std::get<int64_t>(root->values[0][0]->value), 10);
-  ASSERT_EQ(std::get<std::string>(root->values[0][1]->value), "test");
-  ASSERT_EQ(std::get<bool>(root->values[0][2]->value), false);
-  ASSERT_EQ(std::get<int64_t>(root->values[1][0]->value), 12);
-  ASSERT_EQ(std::get<std::string>(root->values[1][1]->value), "test");
-  ASSERT_EQ(std::get<bool>(root->values[1][2]->value), true);
+  ASSERT_EQ(root->values.row_count(), 2);
+  ASSERT_EQ(root->values.column_count(), 3);
+  ASSERT_EQ(std::get<int64_t>(root->values.value(0, 0)), 10);
+  ASSERT_EQ(std::get<std::string>(root->values.value(0, 1)), "test");
+  ASSERT_EQ(std::get<bool>(root->values.value(0, 2)), false);
+  ASSERT_EQ(std::get<int64_t>(root->values.value(1, 0)), 12);
+  ASSERT_EQ(std::get<std::string>(root->values.value(1, 1)), "test");
+  ASSERT_EQ(std::get<bool>(root->values.value(1, 2)), true);
 }
 
 // Error-thrown style tests for INSERT command
@@ -1337,6 +1334,20 @@ TEST_F(ParserTest, InsertTrailingCommaInMultipleRows) {
     parse_query(query);
   }, std::runtime_error);
 }
+
+TEST_F(ParserTest, InsertRowsWithDifferentArity) {
+  std::string query = "INSERT INTO users VALUES (1, 'test'), (2);";  // Second row is short
+  EXPECT_THROW({
+    parse_query(query);
+  }, std::runtime_error);
+}
+
+TEST_F(ParserTest, InsertRowArityDoesNotMatchColumns) {
+  std::string query = "INSERT INTO users (id, name) VALUES (1, 'test', TRUE);";  // More values than columns
+  EXPECT_THROW({
+    parse_query(query);
+  }, std::runtime_error);
+}
 TEST_F(ParserTest, DeleteAllRows) {
     std::string query = "DELETE FROM users;";
     auto ast = parse_query(query);
@@ -1433,3 +1444,429 @@ TEST_F(ParserTest, CreateIndexComposite) {
     EXPECT_EQ(indexStmt->columns[0]->name, "name");
     EXPECT_EQ(indexStmt->columns[1]->name, "age");
 }
+
+TEST_F(ParserTest, UpdateWithArithmeticExpression) {
+    std::string query = "UPDATE counters SET hits = hits + 1 - 0 WHERE id = 7;";
+    auto ast = parse_query(query);
+
+    auto updateStmt = asUpdateStatement(ast);
+    ASSERT_NE(updateStmt, nullptr);
+    ASSERT_EQ(updateStmt->updates.size(), 1);
+
+    // Additive operators are left associative: (hits + 1) - 0
+    auto minus = asBinaryOperation(updateStmt->updates[0].value);
+    ASSERT_NE(minus, nullptr);
+    EXPECT_EQ(minus->op, "-");
+    EXPECT_EQ(std::get<int64_t>(asLiteral(minus->right)->value), 0);
+
+    auto plus = asBinaryOperation(minus->left);
+    ASSERT_NE(plus, nullptr);
+    EXPECT_EQ(plus->op, "+");
+    EXPECT_EQ(asIdentifier(plus->left)->name, "hits");
+    EXPECT_EQ(std::get<int64_t>(asLiteral(plus->right)->value), 1);
+}
+
+TEST_F(ParserTest, SelectAdditionBindsTighterThanComparison) {
+    std::string query = "SELECT id FROM orders WHERE price + 10 > 100 AND active = TRUE;";
+    auto ast = parse_query(query);
+
+    auto select = asSelectStatement(ast);
+    ASSERT_NE(select, nullptr);
+    auto andExpr = asBinaryOperation(select->where_clause);
+    ASSERT_NE(andExpr, nullptr);
+    EXPECT_EQ(andExpr->op, "AND");
+
+    auto greater = asBinaryOperation(andExpr->left);
+    ASSERT_NE(greater, nullptr);
+    EXPECT_EQ(greater->op, ">");
+    auto plus = asBinaryOperation(greater->left);
+    ASSERT_NE(plus, nullptr);
+    EXPECT_EQ(plus->op, "+");
+
+    auto equals = asBinaryOperation(andExpr->right);
+    ASSERT_NE(equals, nullptr);
+    EXPECT_TRUE(std::get<bool>(asLiteral(equals->right)->value));
+}
+
+TEST_F(ParserTest, SelectAggregateFunctionCalls) {
+    std::string query = "SELECT COUNT(*), max(price) AS top, MIN(o.created) FROM orders o;";
+    auto ast = parse_query(query);
+
+    auto select = asSelectStatement(ast);
+    ASSERT_NE(select, nullptr);
+    ASSERT_EQ(select->columns.size(), 3);
+
+    auto count = dynamic_cast<FunctionCallNode*>(select->columns[0].expression.get());
+    ASSERT_NE(count, nullptr);
+    EXPECT_EQ(count->name, "COUNT");
+    EXPECT_TRUE(count->is_star_argument);
+    EXPECT_TRUE(count->arguments.empty());
+
+    auto max = dynamic_cast<FunctionCallNode*>(select->columns[1].expression.get());
+    ASSERT_NE(max, nullptr);
+    EXPECT_EQ(max->name, "max");
+    EXPECT_EQ(select->columns[1].alias, "top");
+    ASSERT_EQ(max->arguments.size(), 1);
+    EXPECT_EQ(asIdentifier(max->arguments[0])->name, "price");
+
+    auto min = dynamic_cast<FunctionCallNode*>(select->columns[2].expression.get());
+    ASSERT_NE(min, nullptr);
+    ASSERT_EQ(min->arguments.size(), 1);
+    EXPECT_NE(asQualifiedIdentifier(min->arguments[0]), nullptr);
+}
+
+TEST_F(ParserTest, FunctionCallInHavingClause) {
+    std::string query = "SELECT region FROM orders GROUP BY region HAVING SUM(amount) > 100;";
+    auto ast = parse_query(query);
+
+    auto select = asSelectStatement(ast);
+    ASSERT_NE(select, nullptr);
+    auto greater = asBinaryOperation(select->group_by->having_clause);
+    ASSERT_NE(greater, nullptr);
+    auto sum = dynamic_cast<FunctionCallNode*>(greater->left.get());
+    ASSERT_NE(sum, nullptr);
+    EXPECT_EQ(sum->name, "SUM");
+    EXPECT_FALSE(sum->is_star_argument);
+}
+
+TEST_F(ParserTest, FunctionCallMissingClosingParenthesis) {
+    std::string query = "SELECT COUNT(* FROM orders;";
+    EXPECT_THROW({
+        parse_query(query);
+    }, std::runtime_error);
+}
+
+TEST_F(ParserTest, CreateMaterializedView) {
+    std::string query = "CREATE MATERIALIZED VIEW daily_sales AS SELECT day, SUM(amount) FROM sales GROUP BY day;";
+    auto ast = parse_query(query);
+
+    auto view = dynamic_cast<CreateMaterializedViewStatementNode*>(ast.get());
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(view->view_name->name, "daily_sales");
+    ASSERT_NE(view->query, nullptr);
+    EXPECT_EQ(view->query->from_clause->name->name, "sales");
+    ASSERT_EQ(view->query->columns.size(), 2);
+    ASSERT_NE(view->query->group_by, nullptr);
+}
+
+TEST_F(ParserTest, CreateMaterializedViewRequiresSelect) {
+    std::string missing_as = "CREATE MATERIALIZED VIEW v SELECT day FROM sales;";
+    EXPECT_THROW({
+        parse_query(missing_as);
+    }, std::runtime_error);
+
+    std::string not_select = "CREATE MATERIALIZED VIEW v AS DELETE FROM sales;";
+    EXPECT_THROW({
+        parse_query(not_select);
+    }, std::runtime_error);
+}
+
+TEST_F(ParserTest, MaterializedAndViewAreIdentifiersOutsideCreateView) {
+    auto create = parse_query("CREATE TABLE view (materialized INT, id INT);");
+    CreateTableStatementNode *table = asCreateTableStatement(create);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->table_name->name, "view");
+    EXPECT_EQ(table->columns[0]->name->name, "materialized");
+
+    auto select = parse_query("SELECT v.materialized AS view FROM view v WHERE materialized > 1;");
+    SelectStatementNode *query = asSelectStatement(select);
+    ASSERT_NE(query, nullptr);
+    EXPECT_EQ(query->from_clause->name->name, "view");
+    EXPECT_EQ(query->columns[0].alias, "view");
+
+    auto view = parse_query("CREATE MATERIALIZED VIEW view AS SELECT materialized, COUNT(*) FROM view GROUP BY materialized;");
+    auto *create_view = dynamic_cast<CreateMaterializedViewStatementNode*>(view.get());
+    ASSERT_NE(create_view, nullptr);
+    EXPECT_EQ(create_view->view_name->name, "view");
+}
+
+TEST_F(ParserTest, StatementKeywordsAreIdentifiersInsideStatements) {
+    auto select = parse_query("SELECT execute, prepare AS deallocate FROM analyze explain WHERE explain.execute > 1;");
+    SelectStatementNode *query = asSelectStatement(select);
+    ASSERT_NE(query, nullptr);
+    EXPECT_EQ(query->from_clause->name->name, "analyze");
+    EXPECT_EQ(query->from_clause->alias, "explain");
+    EXPECT_EQ(query->columns[1].alias, "deallocate");
+
+    auto create = parse_query("CREATE TABLE prepare (execute INT, deallocate INT, analyze INT, explain INT);");
+    CreateTableStatementNode *table = asCreateTableStatement(create);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->table_name->name, "prepare");
+    ASSERT_EQ(table->columns.size(), 4);
+    EXPECT_EQ(table->columns[3]->name->name, "explain");
+
+    // At the start of a statement they are still keywords.
+    auto analyze = parse_query("ANALYZE execute;");
+    auto analyzeNode = dynamic_cast<AnalyzeStatementNode*>(analyze.get());
+    ASSERT_NE(analyzeNode, nullptr);
+    EXPECT_EQ(analyzeNode->table_name->name, "execute");
+    auto prepare = parse_query("PREPARE explain AS SELECT analyze FROM execute WHERE analyze = ?;");
+    auto prepareNode = dynamic_cast<PrepareStatementNode*>(prepare.get());
+    ASSERT_NE(prepareNode, nullptr);
+    EXPECT_EQ(prepareNode->name->name, "explain");
+    EXPECT_NE(dynamic_cast<ExplainStatementNode*>(parse_query("EXPLAIN SELECT explain FROM t;").get()), nullptr);
+}
+
+TEST_F(ParserTest, Analyze) {
+    std::string all_tables = "ANALYZE;";
+    auto ast = parse_query(all_tables);
+    auto analyze = dynamic_cast<AnalyzeStatementNode*>(ast.get());
+    ASSERT_NE(analyze, nullptr);
+    EXPECT_EQ(analyze->table_name, nullptr);
+    EXPECT_TRUE(analyze->columns.empty());
+
+    std::string some_columns = "ANALYZE orders (customer_id, created_at);";
+    ast = parse_query(some_columns);
+    analyze = dynamic_cast<AnalyzeStatementNode*>(ast.get());
+    ASSERT_NE(analyze, nullptr);
+    EXPECT_EQ(analyze->table_name->name, "orders");
+    ASSERT_EQ(analyze->columns.size(), 2);
+    EXPECT_EQ(analyze->columns[1]->name, "created_at");
+
+    std::string unclosed = "ANALYZE orders (customer_id;";
+    EXPECT_THROW({
+        parse_query(unclosed);
+    }, std::runtime_error);
+}
+
+TEST_F(ParserTest, SelectChainOfJoins) {
+    std::string query = "SELECT o.id FROM orders o\n"
+                        "JOIN customers c ON o.customer_id = c.id\n"
+                        "JOIN products p ON o.product_id = p.id\n"
+                        "JOIN regions r ON c.region_id = r.id\n"
+                        "WHERE r.name = 'west';";
+    auto ast = parse_query(query);
+
+    SelectStatementNode* selectNode = asSelectStatement(ast);
+    ASSERT_NE(selectNode, nullptr);
+    ASSERT_EQ(selectNode->join_clause.size(), 3);
+    EXPECT_EQ(selectNode->join_clause[0].table->alias, "c");
+    EXPECT_EQ(selectNode->join_clause[1].table->name->name, "products");
+    EXPECT_EQ(selectNode->join_clause[2].table->alias, "r");
+    for (const auto &join : selectNode->join_clause) {
+        EXPECT_NE(join.on_condition, nullptr);
+    }
+    ASSERT_NE(selectNode->where_clause, nullptr);
+}
+
+TEST_F(ParserTest, Explain) {
+    std::string plain = "EXPLAIN SELECT * FROM orders WHERE id = 1;";
+    auto ast = parse_query(plain);
+    auto explain = dynamic_cast<ExplainStatementNode*>(ast.get());
+    ASSERT_NE(explain, nullptr);
+    EXPECT_FALSE(explain->analyze);
+    ASSERT_NE(asSelectStatement(explain->statement), nullptr);
+
+    std::string analyze = "EXPLAIN ANALYZE DELETE FROM orders WHERE id = 1;";
+    ast = parse_query(analyze);
+    explain = dynamic_cast<ExplainStatementNode*>(ast.get());
+    ASSERT_NE(explain, nullptr);
+    EXPECT_TRUE(explain->analyze);
+    EXPECT_NE(dynamic_cast<DeleteStatementNode*>(explain->statement.get()), nullptr);
+
+    std::string nested = "EXPLAIN EXPLAIN SELECT * FROM orders;";
+    EXPECT_THROW({
+        parse_query(nested);
+    }, std::runtime_error);
+}
+
+TEST_F(ParserTest, SelectWithParameters) {
+    std::string query = "SELECT * FROM orders WHERE customer_id = ? AND total > ?;";
+    Lexer lexer(query);
+    Parser parser(lexer.tokenize());
+    auto ast = parser.parse();
+    EXPECT_EQ(parser.parameter_count(), 2);
+
+    SelectStatementNode* selectNode = asSelectStatement(ast);
+    ASSERT_NE(selectNode, nullptr);
+    auto *conjunction = dynamic_cast<BinaryOperationNode*>(selectNode->where_clause.get());
+    ASSERT_NE(conjunction, nullptr);
+    auto *second = dynamic_cast<BinaryOperationNode*>(conjunction->right.get());
+    ASSERT_NE(second, nullptr);
+    auto *parameter = dynamic_cast<ParameterNode*>(second->right.get());
+    ASSERT_NE(parameter, nullptr);
+    EXPECT_EQ(parameter->index, 2);
+
+    std::string numbered = "SELECT * FROM orders WHERE customer_id = $2 OR id = $1;";
+    Lexer numbered_lexer(numbered);
+    Parser numbered_parser(numbered_lexer.tokenize());
+    numbered_parser.parse();
+    EXPECT_EQ(numbered_parser.parameter_count(), 2);
+
+    std::string mixed = "SELECT * FROM orders WHERE customer_id = $1 AND id = ?;";
+    EXPECT_THROW({
+        parse_query(mixed);
+    }, std::runtime_error);
+
+    std::string zero = "SELECT * FROM orders WHERE id = $0;";
+    EXPECT_THROW({
+        parse_query(zero);
+    }, std::runtime_error);
+}
+
+TEST_F(ParserTest, InsertWithParameters) {
+    std::string query = "INSERT INTO users (id, name, active) VALUES (?, 'ann', ?), (?, 'bob', TRUE);";
+    auto ast = parse_query(query);
+    InsertStatementNode* insertNode = asInsertStatement(ast);
+    ASSERT_NE(insertNode, nullptr);
+    ASSERT_EQ(insertNode->values.row_count(), 2);
+    ASSERT_EQ(insertNode->values.column_count(), 3);
+    EXPECT_EQ(std::get<std::string>(insertNode->values.value(0, 1)), "ann");
+
+    ASSERT_EQ(insertNode->parameters.size(), 3);
+    EXPECT_EQ(insertNode->parameters[1].row, 0);
+    EXPECT_EQ(insertNode->parameters[1].column, 2);
+    EXPECT_EQ(insertNode->parameters[1].index, 2);
+    EXPECT_EQ(insertNode->parameters[2].row, 1);
+    EXPECT_EQ(insertNode->parameters[2].column, 0);
+    EXPECT_EQ(insertNode->parameters[2].index, 3);
+}
+
+TEST_F(ParserTest, PrepareExecuteDeallocate) {
+    std::string prepare = "PREPARE by_customer AS SELECT * FROM orders WHERE customer_id = $1;";
+    auto ast = parse_query(prepare);
+    auto prepareNode = dynamic_cast<PrepareStatementNode*>(ast.get());
+    ASSERT_NE(prepareNode, nullptr);
+    EXPECT_EQ(prepareNode->name->name, "by_customer");
+    EXPECT_EQ(prepareNode->parameter_count, 1);
+    ASSERT_NE(asSelectStatement(prepareNode->statement), nullptr);
+
+    std::string execute = "EXECUTE by_customer (42, 'west');";
+    ast = parse_query(execute);
+    auto executeNode = dynamic_cast<ExecuteStatementNode*>(ast.get());
+    ASSERT_NE(executeNode, nullptr);
+    EXPECT_EQ(executeNode->name->name, "by_customer");
+    ASSERT_EQ(executeNode->arguments.size(), 2);
+    EXPECT_EQ(std::get<int64_t>(executeNode->arguments[0]->value), 42);
+
+    std::string no_arguments = "EXECUTE all_orders;";
+    ast = parse_query(no_arguments);
+    executeNode = dynamic_cast<ExecuteStatementNode*>(ast.get());
+    ASSERT_NE(executeNode, nullptr);
+    EXPECT_TRUE(executeNode->arguments.empty());
+
+    std::string deallocate = "DEALLOCATE by_customer;";
+    ast = parse_query(deallocate);
+    auto deallocateNode = dynamic_cast<DeallocateStatementNode*>(ast.get());
+    ASSERT_NE(deallocateNode, nullptr);
+    EXPECT_EQ(deallocateNode->name->name, "by_customer");
+
+    std::string parameter_argument = "EXECUTE by_customer (?);";
+    EXPECT_THROW({
+        parse_query(parameter_argument);
+    }, std::runtime_error);
+
+    std::string prepare_ddl = "PREPARE drop_it AS DROP TABLE orders;";
+    EXPECT_THROW({
+        parse_query(prepare_ddl);
+    }, std::runtime_error);
+}
+
+TEST_F(ParserTest, EscapedQuoteInStringLiteral) {
+    std::string query = "INSERT INTO notes VALUES (1, 'it''s ''quoted''');";
+    auto ast = parse_query(query);
+    InsertStatementNode* insertNode = asInsertStatement(ast);
+    ASSERT_NE(insertNode, nullptr);
+    ASSERT_EQ(insertNode->values.column_count(), 2);
+    EXPECT_EQ(std::get<std::string>(insertNode->values.value(0, 1)), "it's 'quoted'");
+}
+
+TEST_F(ParserTest, StreamsStatementsFromLexer) {
+    std::string script = "CREATE TABLE t (id INT);\n"
+                         "INSERT INTO t VALUES (1), (2);;\n"
+                         "SELECT id FROM t WHERE id > 1";
+    Lexer lexer(script);
+    Parser parser(lexer);
+
+    auto create = parser.next_statement();
+    EXPECT_NE(dynamic_cast<CreateTableStatementNode*>(create.get()), nullptr);
+    auto insert = parser.next_statement();
+    InsertStatementNode* insertNode = asInsertStatement(insert);
+    ASSERT_NE(insertNode, nullptr);
+    EXPECT_EQ(insertNode->values.row_count(), 2);
+    auto select = parser.next_statement();
+    EXPECT_NE(dynamic_cast<SelectStatementNode*>(select.get()), nullptr);
+    EXPECT_EQ(parser.next_statement(), nullptr);
+    EXPECT_EQ(parser.next_statement(), nullptr);
+
+    std::string missing_separator = "DROP TABLE a DROP TABLE b;";
+    Lexer second(missing_separator);
+    Parser unterminated(second);
+    EXPECT_THROW(unterminated.next_statement(), std::runtime_error);
+}
+
+TEST_F(ParserTest, ParametersAreNumberedPerStatement) {
+    std::string script = "SELECT a FROM t WHERE a = ?;"
+                         "SELECT b FROM t WHERE b = $1;"
+                         "SELECT c FROM t WHERE c = ?;"
+                         "SELECT d FROM t;";
+    Lexer lexer(script);
+    Parser parser(lexer);
+
+    parser.next_statement();
+    EXPECT_EQ(parser.parameter_count(), 1);
+    parser.next_statement();
+    EXPECT_EQ(parser.parameter_count(), 1);
+
+    auto third = parser.next_statement();
+    EXPECT_EQ(parser.parameter_count(), 1);
+    SelectStatementNode* selectNode = asSelectStatement(third);
+    ASSERT_NE(selectNode, nullptr);
+    auto *condition = dynamic_cast<BinaryOperationNode*>(selectNode->where_clause.get());
+    ASSERT_NE(condition, nullptr);
+    auto *parameter = dynamic_cast<ParameterNode*>(condition->right.get());
+    ASSERT_NE(parameter, nullptr);
+    EXPECT_EQ(parameter->index, 1);
+
+    parser.next_statement();
+    EXPECT_EQ(parser.parameter_count(), 0);
+}
+
+TEST_F(ParserTest, EachPrepareCountsOnlyItsOwnParameters) {
+    std::string script = "PREPARE a AS SELECT x FROM t WHERE x = ?;"
+                         "PREPARE b AS SELECT y FROM u WHERE y = ?;";
+    Lexer lexer(script);
+    Parser parser(lexer);
+
+    for (const char *name : {"a", "b"}) {
+        auto ast = parser.next_statement();
+        auto prepareNode = dynamic_cast<PrepareStatementNode*>(ast.get());
+        ASSERT_NE(prepareNode, nullptr);
+        EXPECT_EQ(prepareNode->name->name, name);
+        EXPECT_EQ(prepareNode->parameter_count, 1) << name;
+        EXPECT_EQ(parser.parameter_count(), 0);
+    }
+}
+
+TEST_F(ParserTest, InsertValuesAreStoredByColumn) {
+    std::string query = "INSERT INTO t VALUES (1, 'a', 1.5, ?), (2, 'b', 2, ?), (3, 'c', 3.5, ?);";
+    auto ast = parse_query(query);
+    InsertStatementNode* insertNode = asInsertStatement(ast);
+    ASSERT_NE(insertNode, nullptr);
+    const ValueBlock& values = insertNode->values;
+    ASSERT_EQ(values.row_count(), 3);
+    ASSERT_EQ(values.column_count(), 4);
+
+    auto* ids = std::get_if<std::vector<int64_t>>(&values.column(0));
+    ASSERT_NE(ids, nullptr);
+    EXPECT_EQ(*ids, (std::vector<int64_t>{1, 2, 3}));
+    auto* names = std::get_if<std::vector<std::string>>(&values.column(1));
+    ASSERT_NE(names, nullptr);
+    EXPECT_EQ((*names)[2], "c");
+
+    // A column mixing integers and floats keeps each value's own type.
+    auto* prices = std::get_if<std::vector<LiteralValue>>(&values.column(2));
+    ASSERT_NE(prices, nullptr);
+    EXPECT_EQ(std::get<double>((*prices)[0]), 1.5);
+    EXPECT_EQ(std::get<int64_t>((*prices)[1]), 2);
+
+    // A column of placeholders is typed once its parameters are bound.
+    ValueBlock bound = bind_insert_values(*insertNode, {std::string("x"), std::string("y"), std::string("z")});
+    auto* flags = std::get_if<std::vector<std::string>>(&bound.column(3));
+    ASSERT_NE(flags, nullptr);
+    EXPECT_EQ(*flags, (std::vector<std::string>{"x", "y", "z"}));
+    EXPECT_EQ(std::get<int64_t>(bound.value(2, 0)), 3);
+
+    std::string ragged = "INSERT INTO t VALUES (1, 2), (3);";
+    EXPECT_THROW(parse_query(ragged), std::runtime_error);
+}
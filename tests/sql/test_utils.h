@@ -4,8 +4,13 @@
 
 #pragma once
 
+#include "sql/lexer.h"
+#include "sql/parser.h"
 #include "sql/token.h"
 #include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
 using namespace minidb;
 
 inline void assert_tokens_equal(const std::vector<Token>& actual, const std::vector<Token>& expected) {
@@ -14,4 +19,21 @@ inline void assert_tokens_equal(const std::vector<Token>& actual, const std::vec
         EXPECT_EQ(actual[i].type, expected[i].type) << "Token " << i << " type mismatch.";
         EXPECT_EQ(actual[i].text, expected[i].text) << "Token " << i << " text mismatch.";
     }
-}
\ No newline at end of file
+}
+
+inline std::unique_ptr<ASTNode> parse_statement(const std::string& query) {
+    Lexer lexer(query);
+    Parser parser(lexer.tokenize());
+    return parser.parse();
+}
+
+// Parses a statement into ast, which owns it, and returns it as a Node.
+template <typename Node>
+Node& parse_statement_as(const std::string& query, std::unique_ptr<ASTNode>& ast) {
+    ast = parse_statement(query);
+    auto* node = dynamic_cast<Node*>(ast.get());
+    if (node == nullptr) {
+        throw std::runtime_error("Unexpected statement kind: " + query);
+    }
+    return *node;
+}
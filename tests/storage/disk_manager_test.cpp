@@ -9,6 +9,7 @@
 #include <filesystem>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 class DiskManagerTest : public ::testing::Test {
 protected:
@@ -104,6 +105,24 @@ TEST_F(DiskManagerTest, WriteMultiplePages) {
     EXPECT_EQ(memcmp(page2_data, read_buffer, PAGE_SIZE), 0);
 }
 
+// Test writing a run of pages in one call
+TEST_F(DiskManagerTest, WritePagesWritesConsecutiveRun) {
+    DiskManager dm(test_db_file_);
+
+    std::vector<char> run(3 * PAGE_SIZE);
+    memset(run.data(), 'A', PAGE_SIZE);
+    memset(run.data() + PAGE_SIZE, 'B', PAGE_SIZE);
+    memset(run.data() + 2 * PAGE_SIZE, 'C', PAGE_SIZE);
+
+    EXPECT_EQ(dm.write_pages(4, run.data(), 3), IOResult::SUCCESS);
+
+    char read_buffer[PAGE_SIZE];
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(dm.read_page(4 + i, read_buffer), IOResult::SUCCESS);
+        EXPECT_EQ(memcmp(run.data() + i * PAGE_SIZE, read_buffer, PAGE_SIZE), 0);
+    }
+}
+
 // Test writing to non-sequential pages
 TEST_F(DiskManagerTest, WriteNonSequentialPages) {
     DiskManager dm(test_db_file_);
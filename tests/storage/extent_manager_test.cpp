@@ -0,0 +1,65 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "storage/extent_manager.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include "storage/storage_def.h"
+
+class ExtentManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove(db_file);
+        disk = std::make_unique<DiskManager>(db_file);
+
+        // Mark extents 0-3 allocated.
+        char buffer[PAGE_SIZE];
+        std::memset(buffer, 0, sizeof(buffer));
+        auto gam_page = new (buffer) BitmapPage();
+        gam_page->page_type = PageType::GAM;
+        Bitmap gam(gam_page->bitmap, sizeof(gam_page->bitmap) * 8);
+        for (uint32_t extent = 0; extent < 4; extent++) {
+            gam.set(extent);
+        }
+        ASSERT_EQ(disk->write_page(FIRST_GAM_PAGE_ID, buffer), IOResult::SUCCESS);
+    }
+
+    void TearDown() override {
+        disk.reset();
+        std::filesystem::remove(db_file);
+    }
+
+    bool allocated(uint32_t extent) {
+        char buffer[PAGE_SIZE];
+        EXPECT_EQ(disk->read_page(FIRST_GAM_PAGE_ID, buffer), IOResult::SUCCESS);
+        auto gam_page = reinterpret_cast<BitmapPage *>(buffer);
+        return Bitmap(gam_page->bitmap, sizeof(gam_page->bitmap) * 8).is_set(extent);
+    }
+
+    const std::string db_file = "extent_manager_test.db";
+    std::unique_ptr<DiskManager> disk;
+};
+
+TEST_F(ExtentManagerTest, DeallocateExtentsClearsGamBits) {
+    ExtentManager extents(disk.get());
+    EXPECT_EQ(extents.deallocate_extents({EXTENT_SIZE, 3 * EXTENT_SIZE}), IOResult::SUCCESS);
+
+    EXPECT_TRUE(allocated(0));
+    EXPECT_FALSE(allocated(1));
+    EXPECT_TRUE(allocated(2));
+    EXPECT_FALSE(allocated(3));
+}
+
+TEST_F(ExtentManagerTest, DeallocateExtentsRejectsPagesThatDoNotStartAnExtent) {
+    ExtentManager extents(disk.get());
+    EXPECT_EQ(extents.deallocate_extents({2 * EXTENT_SIZE, EXTENT_SIZE + 1}), IOResult::INVALID_PAGE);
+
+    // Nothing is freed when any id is invalid.
+    EXPECT_TRUE(allocated(2));
+    EXPECT_EQ(extents.deallocate_extent(EXTENT_SIZE + 1), IOResult::INVALID_PAGE);
+    EXPECT_EQ(extents.deallocate_extent(2 * EXTENT_SIZE), IOResult::SUCCESS);
+    EXPECT_FALSE(allocated(2));
+}
@@ -0,0 +1,277 @@
+//
+// Created by Amit Chavan on 10/18/26.
+//
+
+#include "storage/table_page.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "storage/config.h"
+
+class TablePageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TablePage(page_data).init();
+    }
+
+    char page_data[PAGE_SIZE];
+};
+
+TEST_F(TablePageTest, InitCreatesEmptyPage) {
+    TablePage page(page_data);
+    EXPECT_EQ(page.get_slot_count(), 0);
+    EXPECT_EQ(page.get_next_page_id(), INVALID_PAGE_ID);
+    EXPECT_EQ(page.free_space(), PAGE_SIZE - sizeof(TablePageHeader) - sizeof(Slot));
+    EXPECT_FALSE(page.get_record(0).has_value());
+}
+
+TEST_F(TablePageTest, InsertAndReadSingleRecord) {
+    TablePage page(page_data);
+    auto slot = page.insert_record("hello");
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_EQ(*slot, 0);
+    EXPECT_EQ(page.get_record(0).value(), "hello");
+}
+
+TEST_F(TablePageTest, InsertRecordsFillsPageAndReportsCount) {
+    TablePage page(page_data);
+    std::string row(100, 'r');
+    std::vector<std::string_view> rows(100, row);
+
+    std::vector<uint16_t> slots;
+    size_t inserted = page.insert_records(rows, 0, &slots);
+
+    size_t capacity = (PAGE_SIZE - sizeof(TablePageHeader)) / (row.size() + sizeof(Slot));
+    EXPECT_EQ(inserted, capacity);
+    EXPECT_EQ(slots.size(), inserted);
+    EXPECT_EQ(page.get_slot_count(), inserted);
+    EXPECT_LT(page.free_space(), row.size());
+
+    // The rest of the batch continues on the next page.
+    char next_data[PAGE_SIZE];
+    TablePage next(next_data);
+    next.init();
+    EXPECT_EQ(page.insert_records(rows, inserted), 0u);
+    EXPECT_EQ(next.insert_records(rows, rows.size()), 0u);
+    EXPECT_EQ(next.insert_records(rows, inserted), std::min(capacity, rows.size() - inserted));
+}
+
+TEST_F(TablePageTest, BatchInsertMatchesRowAtATimeLayout) {
+    std::vector<std::string> values = {"a", "bb", "ccc", "", "eeeee"};
+    std::vector<std::string_view> rows(values.begin(), values.end());
+
+    char single_data[PAGE_SIZE];
+    TablePage single(single_data);
+    single.init();
+    for (const auto &row : rows) {
+        ASSERT_TRUE(single.insert_record(row).has_value());
+    }
+
+    TablePage batched(page_data);
+    ASSERT_EQ(batched.insert_records(rows, 0), rows.size());
+
+    EXPECT_EQ(std::string_view(single_data, PAGE_SIZE), std::string_view(page_data, PAGE_SIZE));
+    for (uint16_t slot = 0; slot < rows.size(); slot++) {
+        EXPECT_EQ(batched.get_record(slot).value(), values[slot]);
+    }
+}
+
+TEST_F(TablePageTest, RecordLargerThanPageIsRejected) {
+    TablePage page(page_data);
+    std::string row(PAGE_SIZE, 'x');
+    EXPECT_FALSE(page.insert_record(row).has_value());
+    EXPECT_EQ(page.get_slot_count(), 0);
+}
+
+TEST_F(TablePageTest, UpdateThatDoesNotGrowStaysInPlace) {
+    TablePage page(page_data);
+    uint16_t slot = page.insert_record("count=10").value();
+    size_t free_before = page.free_space();
+
+    EXPECT_EQ(page.update_record(slot, "count=11"), UpdateResult::InPlace);
+    EXPECT_EQ(page.get_record(slot).value(), "count=11");
+    EXPECT_EQ(page.get_slot_state(slot), SlotState::Normal);
+    EXPECT_EQ(page.get_slot_count(), 1);
+    EXPECT_EQ(page.free_space(), free_before);
+}
+
+TEST_F(TablePageTest, UpdateCanGrowBackIntoItsOriginalSpace) {
+    TablePage page(page_data);
+    uint16_t slot = page.insert_record("status=shipped").value();
+    size_t free_before = page.free_space();
+
+    EXPECT_EQ(page.update_record(slot, "status=new"), UpdateResult::InPlace);
+    EXPECT_EQ(page.update_record(slot, "status=returned"), UpdateResult::HeapOnly);
+    EXPECT_EQ(page.update_record(slot, "status=lost"), UpdateResult::InPlace);
+    EXPECT_EQ(page.get_record(slot).value(), "status=lost");
+
+    uint16_t other = page.insert_record("status=shipped").value();
+    EXPECT_EQ(page.update_record(other, "s=1"), UpdateResult::InPlace);
+    EXPECT_EQ(page.update_record(other, "status=shipped"), UpdateResult::InPlace);
+    EXPECT_EQ(page.get_record(other).value(), "status=shipped");
+    EXPECT_EQ(page.get_slot_state(other), SlotState::Normal);
+    EXPECT_LT(page.free_space(), free_before);
+}
+
+TEST_F(TablePageTest, GrowingUpdateRedirectsToHeapOnlyVersion) {
+    TablePage page(page_data);
+    uint16_t slot = page.insert_record("count=9").value();
+    uint16_t other = page.insert_record("other").value();
+
+    EXPECT_EQ(page.update_record(slot, "count=10"), UpdateResult::HeapOnly);
+    EXPECT_EQ(page.get_slot_state(slot), SlotState::Redirect);
+    EXPECT_EQ(page.get_slot_state(2), SlotState::HeapOnly);
+    EXPECT_EQ(page.get_record(slot).value(), "count=10");
+    EXPECT_EQ(page.get_record(other).value(), "other");
+
+    // Growing again replaces the heap-only version, reusing its slot; the chain stays one hop long.
+    EXPECT_EQ(page.update_record(slot, "count=100"), UpdateResult::HeapOnly);
+    EXPECT_EQ(page.get_slot_state(2), SlotState::HeapOnly);
+    EXPECT_EQ(page.get_record(slot).value(), "count=100");
+
+    // A version that fits is overwritten where it is.
+    EXPECT_EQ(page.update_record(slot, "count=101"), UpdateResult::InPlace);
+    EXPECT_EQ(page.get_record(slot).value(), "count=101");
+    EXPECT_EQ(page.get_slot_count(), 3);
+
+    // Deleting the root frees its heap-only version at once.
+    page.delete_records({slot});
+    EXPECT_EQ(page.get_slot_state(2), SlotState::Free);
+    EXPECT_EQ(page.insert_record("next").value(), 2);
+}
+
+TEST_F(TablePageTest, RepeatedGrowingUpdatesDoNotExhaustTheDirectory) {
+    TablePage page(page_data);
+    uint16_t slot = page.insert_record("c").value();
+    std::string counter = "c";
+    for (int update = 0; update < 2000; update++) {
+        counter += static_cast<char>('0' + update % 10);
+        ASSERT_EQ(page.update_record(slot, counter), UpdateResult::HeapOnly) << update;
+    }
+    EXPECT_EQ(page.get_record(slot).value(), counter);
+    EXPECT_EQ(page.get_slot_count(), 2);
+}
+
+TEST_F(TablePageTest, UpdateReportsNoSpaceWhenPageIsFull) {
+    TablePage page(page_data);
+    std::string row(1000, 'a');
+    std::vector<std::string_view> rows(4, row);
+    ASSERT_EQ(page.insert_records(rows, 0), 4u);
+
+    std::string bigger(1100, 'b');
+    EXPECT_EQ(page.update_record(0, bigger), UpdateResult::NoSpace);
+    EXPECT_EQ(page.get_record(0).value(), row);
+}
+
+TEST_F(TablePageTest, UpdateRejectsHeapOnlyAndMissingSlots) {
+    TablePage page(page_data);
+    uint16_t slot = page.insert_record("a").value();
+    ASSERT_EQ(page.update_record(slot, "abc"), UpdateResult::HeapOnly);
+
+    EXPECT_EQ(page.update_record(1, "x"), UpdateResult::InvalidSlot);
+    EXPECT_EQ(page.update_record(7, "x"), UpdateResult::InvalidSlot);
+}
+
+TEST_F(TablePageTest, DeleteRecordsMarksSlotsDeadInOnePass) {
+    TablePage page(page_data);
+    for (int i = 0; i < 5; i++) {
+        page.insert_record("row" + std::to_string(i));
+    }
+    ASSERT_EQ(page.update_record(4, "row4-grown"), UpdateResult::HeapOnly);
+
+    std::vector<uint16_t> deleted;
+    EXPECT_EQ(page.delete_records({1, 3, 3, 4, 9}, &deleted), 3u);
+    EXPECT_EQ(deleted, (std::vector<uint16_t>{1, 3, 4}));
+    EXPECT_FALSE(page.get_record(1).has_value());
+    EXPECT_FALSE(page.get_record(4).has_value());
+    // The heap-only version behind slot 4 is not addressable from outside the page.
+    EXPECT_EQ(page.get_slot_state(5), SlotState::Free);
+    EXPECT_EQ(page.get_record(2).value(), "row2");
+    EXPECT_FALSE(page.is_empty());
+
+    EXPECT_EQ(page.delete_records({0, 1, 2}), 2u);
+    EXPECT_TRUE(page.is_empty());
+}
+
+TEST_F(TablePageTest, DeletedSpaceIsReclaimedWhenNeeded) {
+    TablePage page(page_data);
+    std::string row(1000, 'a');
+    std::vector<std::string_view> rows(4, row);
+    ASSERT_EQ(page.insert_records(rows, 0), 4u);
+    ASSERT_FALSE(page.insert_record(row).has_value());
+
+    // Deleting does not move data; the next insert that needs the room compacts the page.
+    size_t free_before = page.free_space();
+    page.delete_records({0, 2});
+    EXPECT_EQ(page.free_space(), free_before);
+
+    std::string other(1500, 'b');
+    auto slot = page.insert_record(other);
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_EQ(page.get_record(*slot).value(), other);
+    EXPECT_EQ(page.get_record(1).value(), row);
+    EXPECT_EQ(page.get_record(3).value(), row);
+}
+
+TEST_F(TablePageTest, CompactKeepsSlotNumbersAndDeadSlots) {
+    TablePage page(page_data);
+    for (int i = 0; i < 4; i++) {
+        page.insert_record("value" + std::to_string(i));
+    }
+    page.update_record(1, "v1");
+    page.delete_records({0, 3});
+    page.compact();
+
+    EXPECT_EQ(page.get_slot_count(), 4);
+    EXPECT_FALSE(page.get_record(0).has_value());
+    EXPECT_EQ(page.get_record(1).value(), "v1");
+    EXPECT_EQ(page.get_record(2).value(), "value2");
+    EXPECT_FALSE(page.get_record(3).has_value());
+    EXPECT_EQ(page.free_space(), PAGE_SIZE - sizeof(TablePageHeader) - 5 * sizeof(Slot) - 8);
+
+    // An index may still point at slot 3: a new record must not take it over.
+    EXPECT_EQ(page.insert_record("new").value(), 4);
+    EXPECT_FALSE(page.get_record(3).has_value());
+}
+
+TEST_F(TablePageTest, ReclaimedSlotsAreReusedAndTrimmed) {
+    TablePage page(page_data);
+    for (int i = 0; i < 5; i++) {
+        page.insert_record("value" + std::to_string(i));
+    }
+    page.delete_records({1, 3, 4});
+    // Only slots whose index entries are gone are handed back; 4 stays reserved.
+    EXPECT_EQ(page.reclaim_slots({1, 3, 0, 9}), 2u);
+
+    std::vector<std::string_view> rows = {"a", "b", "c"};
+    std::vector<uint16_t> slots;
+    EXPECT_EQ(page.insert_records(rows, 0, &slots), 3u);
+    EXPECT_EQ(slots, (std::vector<uint16_t>{1, 3, 5}));
+    EXPECT_EQ(page.get_record(3).value(), "b");
+    EXPECT_FALSE(page.get_record(4).has_value());
+
+    // Free slots at the end of the directory are dropped by compaction.
+    page.delete_records({3, 5});
+    page.reclaim_slots({3, 4, 5});
+    EXPECT_EQ(page.get_slot_count(), 6);
+    page.compact();
+    EXPECT_EQ(page.get_slot_count(), 3);
+    EXPECT_EQ(page.insert_record("d").value(), 3);
+}
+
+TEST_F(TablePageTest, InsertDeleteCyclesDoNotExhaustTheDirectory) {
+    TablePage page(page_data);
+    ASSERT_TRUE(page.insert_record("keep").has_value());
+    std::string row(20, 'r');
+    for (int cycle = 0; cycle < 5000; cycle++) {
+        auto slot = page.insert_record(row);
+        ASSERT_TRUE(slot.has_value()) << cycle;
+        page.delete_records({*slot});
+        page.reclaim_slots({*slot});
+    }
+    EXPECT_EQ(page.get_slot_count(), 2);
+    EXPECT_EQ(page.get_record(0).value(), "keep");
+}